@@ -363,6 +363,29 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+#if BN_MUL == ADAPT || BN_SQR == ADAPT || !defined(STRIP)
+	BENCH_BEGIN("bn_mul_toom3") {
+		bn_rand(a, BN_POS, BN_BITS);
+		bn_rand(b, BN_POS, BN_BITS);
+		BENCH_ADD(bn_mul_toom3(c, a, b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("bn_mul_ntt") {
+		bn_rand(a, BN_POS, BN_BITS);
+		bn_rand(b, BN_POS, BN_BITS);
+		BENCH_ADD(bn_mul_ntt(c, a, b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("bn_mul_adapt") {
+		bn_rand(a, BN_POS, BN_BITS);
+		bn_rand(b, BN_POS, BN_BITS);
+		BENCH_ADD(bn_mul_adapt(c, a, b));
+	}
+	BENCH_END;
+#endif
+
 	BENCH_BEGIN("bn_sqr") {
 		bn_rand(a, BN_POS, BN_BITS);
 		BENCH_ADD(bn_sqr(c, a));
@@ -393,6 +416,14 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+#if BN_SQR == ADAPT || !defined(STRIP)
+	BENCH_BEGIN("bn_sqr_adapt") {
+		bn_rand(a, BN_POS, BN_BITS);
+		BENCH_ADD(bn_sqr_adapt(c, a));
+	}
+	BENCH_END;
+#endif
+
 	BENCH_BEGIN("bn_dbl") {
 		bn_rand(a, BN_POS, BN_BITS);
 		BENCH_ADD(bn_dbl(c, a));
@@ -648,6 +679,77 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_BEGIN("bn_mxp_consttime") {
+		bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+		bn_mod(a, a, b);
+		BENCH_ADD(bn_mxp_consttime(c, a, b, b));
+	}
+	BENCH_END;
+
+	{
+		bn_t t[BN_TABLE];
+
+		for (int i = 0; i < BN_TABLE; i++) {
+			bn_null(t[i]);
+			bn_new(t[i]);
+		}
+		BENCH_BEGIN("bn_mxp_pre") {
+			bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+			bn_mod(a, a, b);
+			BENCH_ADD(bn_mxp_pre(t, a, BN_BITS, b));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mxp_fix") {
+			bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+			bn_mod(a, a, b);
+			bn_mxp_pre(t, a, BN_BITS, b);
+			BENCH_ADD(bn_mxp_fix(c, (const bn_t *)t, b, BN_BITS, b));
+		}
+		BENCH_END;
+		for (int i = 0; i < BN_TABLE; i++) {
+			bn_free(t[i]);
+		}
+	}
+
+	BENCH_BEGIN("bn_mxp_sim") {
+		bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+		bn_mod(a, a, b);
+		bn_rand(d, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+		bn_mod(d, d, b);
+		BENCH_ADD(bn_mxp_sim(c, a, b, d, b, b));
+	}
+	BENCH_END;
+
+#if BN_MOD == MONTY || !defined(STRIP)
+	{
+		bn_mont_t ctx;
+
+		bn_mont_null(ctx);
+		bn_mont_new(ctx);
+		BENCH_BEGIN("bn_mont_set") {
+			BENCH_ADD(bn_mont_set(ctx, b));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mont_mxp") {
+			bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+			bn_mod(a, a, b);
+			bn_mont_conv(a, a, ctx);
+			BENCH_ADD(bn_mont_mxp(c, a, b, ctx));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("bn_mont_mxp_consttime") {
+			bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+			bn_mod(a, a, b);
+			BENCH_ADD(bn_mont_mxp_consttime(c, a, b, ctx));
+		}
+		BENCH_END;
+		bn_mont_free(ctx);
+	}
+#endif
+
 	BENCH_BEGIN("bn_mxp_dig") {
 		bn_rand(a, BN_POS, BN_BITS);
 		bn_rand(d, BN_POS, BN_DIGIT);
@@ -746,6 +848,20 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("bn_mod_inv_const") {
+		bn_rand(a, BN_POS, BN_BITS);
+		bn_rand(b, BN_POS, BN_BITS);
+		if (bn_is_even(b)) {
+			bn_add_dig(b, b, 1);
+		}
+		bn_gcd(c, a, b);
+		if (bn_cmp_dig(c, 1) != CMP_EQ) {
+			bn_set_dig(a, 1);
+		}
+		BENCH_ADD(bn_mod_inv_const(c, a, b));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("bn_lcm") {
 		bn_rand(a, BN_POS, BN_BITS);
 		bn_rand(b, BN_POS, BN_BITS);
@@ -785,6 +901,8 @@ static void arith(void) {
 	BENCH_ONCE("bn_gen_prime_stron", bn_gen_prime_stron(a, BN_BITS));
 #endif
 
+	BENCH_ONCE("bn_gen_prime_par", bn_gen_prime_par(a, b, BN_BITS));
+
 	BENCH_ONCE("bn_is_prime", bn_is_prime(a));
 
 	BENCH_ONCE("bn_is_prime_basic", bn_is_prime_basic(a));
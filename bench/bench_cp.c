@@ -87,6 +87,15 @@ static void rsa(void) {
 		cp_rsa_enc(out, &out_len, in, sizeof(in), pub);
 		BENCH_ADD(cp_rsa_dec_quick(new, &new_len, out, out_len, prv));
 	} BENCH_END;
+
+	BENCH_BEGIN("cp_rsa_dec_batch (n = 1)") {
+		uint8_t *pi = out, *po = new;
+		out_len = BN_BITS / 8 + 1;
+		new_len = out_len;
+		rand_bytes(in, sizeof(in));
+		cp_rsa_enc(out, &out_len, in, sizeof(in), pub);
+		BENCH_ADD(cp_rsa_dec_batch(&po, &new_len, &pi, &out_len, 1, prv));
+	} BENCH_END;
 #endif
 
 	BENCH_ONCE("cp_rsa_gen", cp_rsa_gen(pub, prv, BN_BITS));
@@ -159,6 +168,14 @@ static void rsa(void) {
 		md_map(h, in, sizeof(in));
 		BENCH_ADD(cp_rsa_sig_quick(out, &out_len, in, sizeof(in), 1, prv));
 	} BENCH_END;
+
+	BENCH_BEGIN("cp_rsa_sig_batch (n = 1)") {
+		uint8_t *pi = in, *po = out;
+		int in_len = sizeof(in);
+		out_len = BN_BITS / 8 + 1;
+		rand_bytes(in, sizeof(in));
+		BENCH_ADD(cp_rsa_sig_batch(&po, &out_len, &pi, &in_len, 1, 0, prv));
+	} BENCH_END;
 #endif
 
 	rsa_free(pub);
@@ -507,18 +524,28 @@ static void sokaka(void) {
 }
 
 static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	g1_t s;
-	g2_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, b[4][5];
+	uint8_t *ms[4] = { b[0], b[1], b[2], b[3] };
+	int ls[4] = { 5, 5, 5, 5 };
+	g1_t s, t[4];
+	g2_t p, q[4];
 	bn_t d;
 
 	g1_null(s);
 	g2_null(p);
 	bn_null(d);
+	for (int i = 0; i < 4; i++) {
+		g1_null(t[i]);
+		g2_null(q[i]);
+	}
 
 	g1_new(s);
 	g2_new(p);
 	bn_new(d);
+	for (int i = 0; i < 4; i++) {
+		g1_new(t[i]);
+		g2_new(q[i]);
+	}
 
 	BENCH_BEGIN("cp_bls_gen") {
 		BENCH_ADD(cp_bls_gen(d, p));
@@ -535,9 +562,34 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	for (int i = 0; i < 4; i++) {
+		rand_bytes(b[i], ls[i]);
+		cp_bls_gen(d, q[i]);
+		cp_bls_sig(t[i], b[i], ls[i], d);
+	}
+
+	BENCH_BEGIN("cp_bls_agg (4)") {
+		BENCH_ADD(cp_bls_agg(s, t, 4));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_bls_ver_agg (4)") {
+		BENCH_ADD(cp_bls_ver_agg(s, ms, ls, q, 4));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_bls_ver_batch (4)") {
+		BENCH_ADD(cp_bls_ver_batch(t, ms, ls, q, 4));
+	}
+	BENCH_END;
+
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
+	for (int i = 0; i < 4; i++) {
+		g1_free(t[i]);
+		g2_free(q[i]);
+	}
 }
 
 static void bbs(void) {
@@ -154,8 +154,8 @@ static void util(void) {
 }
 
 static void arith(void) {
-	eb_t p, q, r, t[EB_TABLE_MAX];
-	bn_t k, l, n;
+	eb_t p, q, r, t[EB_TABLE_MAX], _p[256];
+	bn_t k, l, n, _k[256];
 
 	eb_null(p);
 	eb_null(q);
@@ -173,6 +173,13 @@ static void arith(void) {
 	bn_new(n);
 	bn_new(l);
 
+	for (int i = 0; i < 256; i++) {
+		eb_null(_p[i]);
+		bn_null(_k[i]);
+		eb_new(_p[i]);
+		bn_new(_k[i]);
+	}
+
 	eb_curve_get_ord(n);
 
 	BENCH_BEGIN("eb_add") {
@@ -649,6 +656,20 @@ static void arith(void) {
 		BENCH_ADD(eb_mul_sim_gen(r, k, q, l));
 	} BENCH_END;
 
+	for (int i = 0; i < 256; i++) {
+		bn_rand(_k[i], BN_POS, bn_bits(n));
+		bn_mod(_k[i], _k[i], n);
+		eb_rand(_p[i]);
+	}
+
+	BENCH_BEGIN("eb_mul_sim_lot (16)") {
+		BENCH_ADD(eb_mul_sim_lot(r, (const eb_t *)_p, (const bn_t *)_k, 16));
+	} BENCH_END;
+
+	BENCH_BEGIN("eb_mul_sim_lot (256)") {
+		BENCH_ADD(eb_mul_sim_lot(r, (const eb_t *)_p, (const bn_t *)_k, 256));
+	} BENCH_END;
+
 	BENCH_BEGIN("eb_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
@@ -670,6 +691,10 @@ static void arith(void) {
 	bn_free(k);
 	bn_free(l);
 	bn_free(n);
+	for (int i = 0; i < 256; i++) {
+		eb_free(_p[i]);
+		bn_free(_k[i]);
+	}
 }
 
 static void bench(void) {
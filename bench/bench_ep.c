@@ -154,8 +154,8 @@ static void util(void) {
 }
 
 static void arith(void) {
-	ep_t p, q, r, t[EP_TABLE_MAX];
-	bn_t k, l, n;
+	ep_t p, q, r, t[EP_TABLE_MAX], _p[256];
+	bn_t k, l, n, _k[256];
 
 	ep_null(p);
 	ep_null(q);
@@ -171,6 +171,13 @@ static void arith(void) {
 	bn_new(n);
 	bn_new(l);
 
+	for (int i = 0; i < 256; i++) {
+		ep_null(_p[i]);
+		bn_null(_k[i]);
+		ep_new(_p[i]);
+		bn_new(_k[i]);
+	}
+
 	ep_curve_get_ord(n);
 
 	BENCH_BEGIN("ep_add") {
@@ -585,6 +592,20 @@ static void arith(void) {
 		BENCH_ADD(ep_mul_sim_gen(r, k, q, l));
 	} BENCH_END;
 
+	for (int i = 0; i < 256; i++) {
+		bn_rand(_k[i], BN_POS, bn_bits(n));
+		bn_mod(_k[i], _k[i], n);
+		ep_rand(_p[i]);
+	}
+
+	BENCH_BEGIN("ep_mul_sim_lot (16)") {
+		BENCH_ADD(ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, 16));
+	} BENCH_END;
+
+	BENCH_BEGIN("ep_mul_sim_lot (256)") {
+		BENCH_ADD(ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, 256));
+	} BENCH_END;
+
 	BENCH_BEGIN("ep_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
@@ -607,6 +628,10 @@ static void arith(void) {
 	bn_free(k);
 	bn_free(l);
 	bn_free(n);
+	for (int i = 0; i < 256; i++) {
+		ep_free(_p[i]);
+		bn_free(_k[i]);
+	}
 }
 
 static void bench(void) {
@@ -140,8 +140,8 @@ static void util(void) {
 }
 
 static void arith(void) {
-	ep2_t p, q, r, t[EPX_TABLE_MAX];
-	bn_t k, n, l;
+	ep2_t p, q, r, t[EPX_TABLE_MAX], _p[256];
+	bn_t k, n, l, _k[256];
 	fp2_t s;
 
 	ep2_null(p);
@@ -162,6 +162,13 @@ static void arith(void) {
 	bn_new(l);
 	fp2_new(s);
 
+	for (int i = 0; i < 256; i++) {
+		ep2_null(_p[i]);
+		bn_null(_k[i]);
+		ep2_new(_p[i]);
+		bn_new(_k[i]);
+	}
+
 	ep2_curve_get_ord(n);
 
 	BENCH_BEGIN("ep2_add") {
@@ -347,6 +354,46 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+#if EP_MUL == BASIC || !defined(STRIP)
+	BENCH_BEGIN("ep2_mul_basic") {
+		bn_rand(k, BN_POS, bn_bits(n));
+		bn_mod(k, k, n);
+		BENCH_ADD(ep2_mul_basic(q, p, k));
+	} BENCH_END;
+#endif
+
+#if EP_MUL == SLIDE || !defined(STRIP)
+	BENCH_BEGIN("ep2_mul_slide") {
+		bn_rand(k, BN_POS, bn_bits(n));
+		bn_mod(k, k, n);
+		BENCH_ADD(ep2_mul_slide(q, p, k));
+	} BENCH_END;
+#endif
+
+#if EP_MUL == MONTY || !defined(STRIP)
+	BENCH_BEGIN("ep2_mul_monty") {
+		bn_rand(k, BN_POS, bn_bits(n));
+		bn_mod(k, k, n);
+		BENCH_ADD(ep2_mul_monty(q, p, k));
+	} BENCH_END;
+#endif
+
+#if EP_MUL == LWNAF || !defined(STRIP)
+	BENCH_BEGIN("ep2_mul_lwnaf") {
+		bn_rand(k, BN_POS, bn_bits(n));
+		bn_mod(k, k, n);
+		BENCH_ADD(ep2_mul_lwnaf(q, p, k));
+	} BENCH_END;
+#endif
+
+#if EP_MUL == LWREG || !defined(STRIP)
+	BENCH_BEGIN("ep2_mul_lwreg") {
+		bn_rand(k, BN_POS, bn_bits(n));
+		bn_mod(k, k, n);
+		BENCH_ADD(ep2_mul_lwreg(q, p, k));
+	} BENCH_END;
+#endif
+
 	BENCH_BEGIN("ep2_mul_gen") {
 		bn_rand(k, BN_POS, bn_bits(n));
 		bn_mod(k, k, n);
@@ -572,6 +619,20 @@ static void arith(void) {
 		BENCH_ADD(ep2_mul_sim_gen(r, k, q, l));
 	} BENCH_END;
 
+	for (int i = 0; i < 256; i++) {
+		bn_rand(_k[i], BN_POS, bn_bits(n));
+		bn_mod(_k[i], _k[i], n);
+		ep2_rand(_p[i]);
+	}
+
+	BENCH_BEGIN("ep2_mul_sim_lot (16)") {
+		BENCH_ADD(ep2_mul_sim_lot(r, _p, _k, 16));
+	} BENCH_END;
+
+	BENCH_BEGIN("ep2_mul_sim_lot (256)") {
+		BENCH_ADD(ep2_mul_sim_lot(r, _p, _k, 256));
+	} BENCH_END;
+
 	BENCH_BEGIN("ep2_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
@@ -594,6 +655,10 @@ static void arith(void) {
 	bn_free(k);
 	bn_free(n);
 	bn_free(l);
+	for (int i = 0; i < 256; i++) {
+		ep2_free(_p[i]);
+		bn_free(_k[i]);
+	}
 	fp2_free(s);
 }
 
@@ -172,7 +172,7 @@ static void util(void) {
 }
 
 static void arith(void) {
-	fp_t a, b, c, f[2];
+	fp_t a, b, c, f[FP_LANES];
 	dv_t d;
 	bn_t e;
 
@@ -181,16 +181,18 @@ static void arith(void) {
 	fp_null(c);
 	dv_null(d);
 	bn_null(e);
-	fp_null(f[0]);
-	fp_null(f[1]);
+	for (int k = 0; k < FP_LANES; k++) {
+		fp_null(f[k]);
+	}
 
 	fp_new(a);
 	fp_new(b);
 	fp_new(c);
 	dv_new(d);
 	bn_new(e);
-	fp_new(f[0]);
-	fp_new(f[1]);
+	for (int k = 0; k < FP_LANES; k++) {
+		fp_new(f[k]);
+	}
 
 	dv_zero(d, DV_DIGS);
 
@@ -330,6 +332,29 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp_mul_unr") {
+		fp_rand(a);
+		fp_rand(b);
+		BENCH_ADD(fp_mul_unr(d, a, b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_mla_unr") {
+		fp_rand(a);
+		fp_rand(b);
+		fp_mul_unr(d, a, b);
+		BENCH_ADD(fp_mla_unr(d, a, b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_mul_sim (8)") {
+		for (int k = 0; k < FP_LANES; k++) {
+			fp_rand(f[k]);
+		}
+		BENCH_ADD(fp_mul_sim(f, (const fp_t *)f, (const fp_t *)f, FP_LANES));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_sqr") {
 		fp_rand(a);
 		BENCH_ADD(fp_sqr(c, a));
@@ -559,6 +584,12 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_BEGIN("fp_exp_chain") {
+		fp_rand(a);
+		BENCH_ADD(fp_exp_chain(c, a, fp_prime_get_chain(FP_CHAIN_INV)));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_srt") {
 		fp_rand(a);
 		fp_sqr(a, a);
@@ -589,8 +620,9 @@ static void arith(void) {
 	fp_free(c);
 	dv_free(d);
 	bn_free(e);
-	fp_free(f[0]);
-	fp_free(f[1]);
+	for (int k = 0; k < FP_LANES; k++) {
+		fp_free(f[k]);
+	}
 }
 
 int main(void) {
@@ -186,9 +186,10 @@ static void pairing2(void) {
 
 static void pairing12(void) {
 	bn_t k, n, l;
-	ep2_t p, r;
-	ep_t q;
+	ep2_t p, r, _p[2];
+	ep_t q, _q[2];
 	fp12_t e;
+	fp6_t t[PP_TABLE];
 
 	ep2_null(p);
 	ep2_null(r);
@@ -197,6 +198,13 @@ static void pairing12(void) {
 	bn_null(n);
 	bn_null(l);
 	fp12_null(e);
+	for (int j = 0; j < 2; j++) {
+		ep2_null(_p[j]);
+		ep_null(_q[j]);
+	}
+	for (int j = 0; j < PP_TABLE; j++) {
+		fp6_null(t[j]);
+	}
 
 	bn_new(k);
 	bn_new(n);
@@ -205,6 +213,13 @@ static void pairing12(void) {
 	ep2_new(r);
 	ep_new(q);
 	fp12_new(e);
+	for (int j = 0; j < 2; j++) {
+		ep2_new(_p[j]);
+		ep_new(_q[j]);
+	}
+	for (int j = 0; j < PP_TABLE; j++) {
+		fp6_new(t[j]);
+	}
 
 	ep2_curve_get_ord(n);
 
@@ -339,6 +354,29 @@ static void pairing12(void) {
 		BENCH_ADD(pp_map_oatep_k12(e, q, p));
 	}
 	BENCH_END;
+
+	BENCH_BEGIN("pp_map_sim_oatep_k12 (2)") {
+		for (int j = 0; j < 2; j++) {
+			ep2_rand(_p[j]);
+			ep_rand(_q[j]);
+		}
+		BENCH_ADD(pp_map_sim_oatep_k12(e, _q, _p, 2));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_pre_k12") {
+		ep2_rand(p);
+		BENCH_ADD(pp_map_pre_k12(t, p));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_fix_k12") {
+		ep2_rand(p);
+		ep_rand(q);
+		pp_map_pre_k12(t, p);
+		BENCH_ADD(pp_map_fix_k12(e, q, t));
+	}
+	BENCH_END;
 #endif
 
 	bn_free(k);
@@ -348,6 +386,13 @@ static void pairing12(void) {
 	ep2_free(r);
 	ep_free(q);
 	fp12_free(e);
+	for (int j = 0; j < 2; j++) {
+		ep2_free(_p[j]);
+		ep_free(_q[j]);
+	}
+	for (int j = 0; j < PP_TABLE; j++) {
+		fp6_free(t[j]);
+	}
 }
 
 int main(void) {
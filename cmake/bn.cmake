@@ -5,14 +5,18 @@ message("      BN_PRECI=n        The base precision in bits. Let w be n in words
 message("      BN_MAGNI=DOUBLE   A multiple precision integer can store 2w words.")
 message("      BN_MAGNI=CARRY    A multiple precision integer can store w+1 words.")
 message("      BN_MAGNI=SINGLE   A multiple precision integer can store w words.")
-message("      BN_KARAT=n        The number of Karatsuba steps.\n")
+message("      BN_KARAT=n        The number of Karatsuba steps.")
+message("      BN_TOOM3=n        Minimum size in words for Toom-3 multiplication.")
+message("      BN_DEPTH=w        Width w of precomputation table for fixed-base exponentiation.\n")
 
 message("   ** Available multiple precision arithmetic methods (default = COMBA;COMBA;MONTY;SLIDE;STEIN;BASIC):")
 message("      BN_METHD=BASIC    Schoolbook multiplication.")
-message("      BN_METHD=COMBA    Comba multiplication.\n")
+message("      BN_METHD=COMBA    Comba multiplication.")
+message("      BN_METHD=ADAPT    Karatsuba or Toom-3 multiplication chosen by size.\n")
 
 message("      BN_METHD=BASIC    Schoolbook squaring.")
 message("      BN_METHD=COMBA    Comba squaring.")
+message("      BN_METHD=ADAPT    Karatsuba or Toom-3 squaring chosen by size.")
 message("      BN_METHD=MULTP    Reuse multiplication for squaring.\n")
 
 message("      BN_METHD=BASIC    Division-based modular reduction.")
@@ -45,6 +49,18 @@ if (NOT BN_KARAT)
 endif(NOT BN_KARAT)
 set(BN_KARAT ${BN_KARAT} CACHE INTEGER "Number of Karatsuba levels.")
 
+# Fix the threshold for Toom-3 multiplication.
+if (NOT BN_TOOM3)
+	set(BN_TOOM3 96)
+endif(NOT BN_TOOM3)
+set(BN_TOOM3 ${BN_TOOM3} CACHE INTEGER "Minimum size for Toom-3 multiplication.")
+
+# Fix the width of the fixed-base exponentiation table.
+if (NOT BN_DEPTH)
+	set(BN_DEPTH 6)
+endif(NOT BN_DEPTH)
+set(BN_DEPTH ${BN_DEPTH} CACHE INTEGER "Width of precomputation table for fixed-base exponentiation.")
+
 if (NOT BN_MAGNI)
 	set(BN_MAGNI "DOUBLE")
 endif(NOT BN_MAGNI)
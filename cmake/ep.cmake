@@ -14,7 +14,8 @@ message("      EP_METHD=BASIC    Affine coordinates.")
 message("      EP_METHD=PROJC    Jacobian projective coordinates.\n")
  
 message("      EP_METHD=BASIC    Binary method.")
-message("      EP_METHD=LWNAF    Left-to-right window NAF method (GLV for Koblitz curves).\n")
+message("      EP_METHD=LWNAF    Left-to-right window NAF method (GLV for Koblitz curves).")
+message("      EP_METHD=LWREG    Left-to-right regular recoding method (GLV for curves with endomorphisms).\n")
 
 message("      EP_METHD=BASIC    Binary method for fixed point multiplication.")
 message("      EP_METHD=YAOWI    Yao's windowing method for fixed point multiplication")
@@ -292,7 +292,7 @@ void bn_div1_low(dig_t *c, dig_t *d, const dig_t *a, int size, dig_t digit);
 /**
  * Reduces a digit vector modulo m by Montgomery's algorithm.
  *
- * @param[out] c			- the result.
+ * @param[out] c			- the result, with room for 2 * sizem digits.
  * @param[in] a				- the digit vector to reduce.
  * @param[in] sizea			- the number of digits to reduce
  * @param[in] m				- the modulus.
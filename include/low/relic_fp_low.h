@@ -316,6 +316,26 @@ void fp_muln_low(dig_t *c, const dig_t *a, const dig_t *b);
  */
 void fp_mulm_low(dig_t *c, const dig_t *a, const dig_t *b);
 
+/**
+ * Multiplies up to FP_LANES pairs of digit vectors with embedded modular
+ * reduction, using vector instructions when available. Computes
+ * c[i] = (a[i] * b[i]) mod p for 0 <= i < n. Each c[i] may alias a[i] or b[i].
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first digit vectors to multiply.
+ * @param[in] b				- the second digit vectors to multiply.
+ * @param[in] n				- the number of products.
+ */
+void fp_mulv_low(dig_t *c[], const dig_t *a[], const dig_t *b[], int n);
+
+/**
+ * Returns the number of products computed at once by fp_mulv_low() on this
+ * processor, or 1 if no vectorized kernel is available.
+ *
+ * @return the number of lanes.
+ */
+int fp_lanes_low(void);
+
 /**
  * Squares a digit vector. Computes c = a * a.
  *
@@ -71,6 +71,31 @@
 #define FETCH(STR, ID, L)	strncpy(STR, ID, L);
 #endif
 
+/**
+ * Represents the carry-less multiplication extension (PCLMULQDQ).
+ */
+#define ARCH_CLMUL		0x01
+
+/**
+ * Represents the flag-preserving multiplication extension (BMI2).
+ */
+#define ARCH_BMI2		0x02
+
+/**
+ * Represents the multiple-carry addition extension (ADX).
+ */
+#define ARCH_ADX		0x04
+
+/**
+ * Represents the 256-bit integer vector extension (AVX2).
+ */
+#define ARCH_AVX2		0x08
+
+/**
+ * Represents the 52-bit integer multiply-add vector extension (AVX-512 IFMA).
+ */
+#define ARCH_IFMA		0x10
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -90,6 +115,27 @@ void arch_clean(void);
  */
 ull_t arch_cycles(void);
 
+#if ARCH == X64
+
+/**
+ * Returns the instruction set extensions used by the arithmetic kernels. The
+ * extensions are detected once, when the library is first initialized.
+ *
+ * @return the set of extensions, as a bitwise OR of ARCH_* flags.
+ */
+int arch_get_ext(void);
+
+/**
+ * Restricts the instruction set extensions used by the arithmetic kernels to
+ * those supported by the processor and present in the given set. The setting
+ * is shared by all threads, so it must not change while others are running.
+ *
+ * @param[in] ext		- the set of extensions, as a bitwise OR of ARCH_* flags.
+ */
+void arch_set_ext(int ext);
+
+#endif
+
 #if ARCH == AVR
 
 /**
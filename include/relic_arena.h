@@ -0,0 +1,149 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2014 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Interface of the memory-management routines for the arena memory allocator.
+ *
+ * @version $Id$
+ * @ingroup relic
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef RELIC_ARENA_H
+#define RELIC_ARENA_H
+
+#include "relic_conf.h"
+#include "relic_types.h"
+#include "relic_util.h"
+#include "relic_label.h"
+
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+#if ALLOC == ARENA
+
+/**
+ * The minimum size in bytes of each block of memory reserved by the arena.
+ */
+#ifndef ARENA_SIZE
+#define ARENA_SIZE	(64 * 1024)
+#endif
+
+/**
+ * The alignment in bytes of the memory returned by the arena.
+ */
+#define ARENA_ALIGN	(ALIGN > 16 ? ALIGN : 16)
+
+#endif
+
+/*============================================================================*/
+/* Type definitions                                                           */
+/*============================================================================*/
+
+/**
+ * Type that represents a block of memory reserved by the arena.
+ */
+typedef struct _arena_t {
+	/** The next block, kept for reuse after a scope is closed. */
+	struct _arena_t *next;
+	/** The size in bytes of the usable memory in this block. */
+	size_t size;
+} arena_t;
+
+/*============================================================================*/
+/* Function prototypes                                                        */
+/*============================================================================*/
+
+/**
+ * Opens an arena scope. Until the scope is closed, temporaries are allocated
+ * by bumping a pointer in the arena of the current library context. Scopes
+ * can be nested. Does nothing if the library is not built with the arena
+ * allocator.
+ */
+void arena_open(void);
+
+/**
+ * Closes the innermost arena scope, releasing at once all memory allocated
+ * from the arena since the scope was opened. Does nothing if the library is
+ * not built with the arena allocator.
+ */
+void arena_close(void);
+
+#if ALLOC == ARENA
+
+/**
+ * Initializes the arena for the current library context.
+ */
+void arena_init(void);
+
+/**
+ * Releases all memory reserved by the arena of the current library context.
+ */
+void arena_clean(void);
+
+/**
+ * Allocates memory from the arena if a scope is open, or from the heap
+ * otherwise.
+ *
+ * @param[in] size			- the number of bytes to allocate.
+ * @returns the address of the allocated memory, or NULL if no memory is left.
+ */
+void *arena_get(size_t size);
+
+/**
+ * Resizes memory obtained with arena_get(), preserving its contents. The
+ * resized memory is taken from the heap, so it survives any open scope until
+ * released with arena_put().
+ *
+ * @param[in] a				- the address of the memory to resize.
+ * @param[in] size			- the new number of bytes.
+ * @returns the address of the resized memory, or NULL if no memory is left.
+ */
+void *arena_grow(void *a, size_t size);
+
+/**
+ * Releases memory obtained with arena_get(). Memory allocated in a scope is
+ * only reclaimed immediately if it is the last allocation, otherwise it is
+ * reclaimed when the scope is closed.
+ *
+ * @param[in] a				- the address to free.
+ */
+void arena_put(void *a);
+
+/**
+ * Closes the open arena scopes until the given one is the innermost. Used by
+ * the error-handling routines when an error skips the matching calls to
+ * arena_close().
+ *
+ * @param[in] mark			- the innermost scope to keep, or NULL for none.
+ */
+void arena_unwind(void *mark);
+
+#endif
+
+#endif /* !RELIC_ARENA_H */
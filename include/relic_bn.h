@@ -85,6 +85,11 @@
 #define BN_SIZE		((int)BN_DIGS)
 #endif
 
+/**
+ * Size of a precomputation table for fixed-base exponentiation.
+ */
+#define BN_TABLE	(1 << BN_DEPTH)
+
 /**
  * Positive sign of a multiple precision integer.
  */
@@ -113,7 +118,7 @@ typedef struct {
 	int used;
 	/** The sign of this multiple precision integer. */
 	int sign;
-#if ALLOC == DYNAMIC || ALLOC == STATIC
+#if ALLOC == DYNAMIC || ALLOC == STATIC || ALLOC == ARENA
 	/** The sequence of contiguous digits that forms this integer. */
 	dig_t *dp;
 #elif ALLOC == STACK || ALLOC == AUTO
@@ -131,6 +136,30 @@ typedef bn_st bn_t[1];
 typedef bn_st *bn_t;
 #endif
 
+/**
+ * Represents the precomputed values for Montgomery arithmetic modulo a fixed
+ * modulus.
+ */
+typedef struct {
+	/** The modulus. */
+	bn_t m;
+	/** The Montgomery reduction constant -m^(-1) mod b. */
+	bn_t u;
+	/** The value R^2 mod m, used to convert integers to Montgomery form. */
+	bn_t r2;
+	/** The value R mod m, which represents one in Montgomery form. */
+	bn_t one;
+} bn_mont_st;
+
+/**
+ * Pointer to a Montgomery arithmetic context.
+ */
+#if ALLOC == AUTO
+typedef bn_mont_st bn_mont_t[1];
+#else
+typedef bn_mont_st *bn_mont_t;
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -160,6 +189,14 @@ typedef bn_st *bn_t;
 	}																		\
 	bn_init(A, BN_SIZE);													\
 
+#elif ALLOC == ARENA
+#define bn_new(A)															\
+	A = (bn_t)arena_get(sizeof(bn_st));										\
+	if ((A) == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_init(A, BN_SIZE);													\
+
 #elif ALLOC == STATIC
 #define bn_new(A)															\
 	A = (bn_t)alloca(sizeof(bn_st));										\
@@ -197,6 +234,14 @@ typedef bn_st *bn_t;
 	}																		\
 	bn_init(A, D);															\
 
+#elif ALLOC == ARENA
+#define bn_new_size(A, D)													\
+	A = (bn_t)arena_get(sizeof(bn_st));										\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_init(A, D);															\
+
 #elif ALLOC == STATIC
 #define bn_new_size(A, D)													\
 	A = (bn_t)alloca(sizeof(bn_st));										\
@@ -229,6 +274,14 @@ typedef bn_st *bn_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == ARENA
+#define bn_free(A)															\
+	if (A != NULL) {														\
+		bn_clean(A);														\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STATIC
 #define bn_free(A)															\
 	if (A != NULL) {														\
@@ -245,6 +298,134 @@ typedef bn_st *bn_t;
 
 #endif
 
+/**
+ * Initializes a Montgomery arithmetic context with a null value.
+ *
+ * @param[out] A			- the context to initialize.
+ */
+#if ALLOC == AUTO
+#define bn_mont_null(A)			/* empty */
+#else
+#define bn_mont_null(A)		A = NULL;
+#endif
+
+/**
+ * Calls a function to allocate and initialize a Montgomery arithmetic context.
+ *
+ * @param[out] A			- the new context.
+ */
+#if ALLOC == DYNAMIC
+#define bn_mont_new(A)														\
+	A = (bn_mont_t)calloc(1, sizeof(bn_mont_st));							\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_null((A)->m);														\
+	bn_null((A)->u);														\
+	bn_null((A)->r2);														\
+	bn_null((A)->one);														\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#elif ALLOC == ARENA
+#define bn_mont_new(A)														\
+	A = (bn_mont_t)arena_get(sizeof(bn_mont_st));							\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_null((A)->m);														\
+	bn_null((A)->u);														\
+	bn_null((A)->r2);														\
+	bn_null((A)->one);														\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#elif ALLOC == STATIC
+#define bn_mont_new(A)														\
+	A = (bn_mont_t)alloca(sizeof(bn_mont_st));								\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_null((A)->m);														\
+	bn_null((A)->u);														\
+	bn_null((A)->r2);														\
+	bn_null((A)->one);														\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#elif ALLOC == AUTO
+#define bn_mont_new(A)														\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#elif ALLOC == STACK
+#define bn_mont_new(A)														\
+	A = (bn_mont_t)alloca(sizeof(bn_mont_st));								\
+	bn_new((A)->m);															\
+	bn_new((A)->u);															\
+	bn_new((A)->r2);														\
+	bn_new((A)->one);														\
+
+#endif
+
+/**
+ * Calls a function to clean and free a Montgomery arithmetic context.
+ *
+ * @param[out] A			- the context to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define bn_mont_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->m);													\
+		bn_free((A)->u);													\
+		bn_free((A)->r2);													\
+		bn_free((A)->one);													\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == ARENA
+#define bn_mont_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->m);													\
+		bn_free((A)->u);													\
+		bn_free((A)->r2);													\
+		bn_free((A)->one);													\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
+#elif ALLOC == STATIC
+#define bn_mont_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->m);													\
+		bn_free((A)->u);													\
+		bn_free((A)->r2);													\
+		bn_free((A)->one);													\
+		A = NULL;															\
+	}																		\
+
+#elif ALLOC == AUTO
+#define bn_mont_free(A)			/* empty */
+
+#elif ALLOC == STACK
+#define bn_mont_free(A)														\
+	bn_free((A)->m);														\
+	bn_free((A)->u);														\
+	bn_free((A)->r2);														\
+	bn_free((A)->one);														\
+	A = NULL;																\
+
+#endif
+
 /**
  * Multiples two multiple precision integers. Computes c = a * b.
  *
@@ -252,7 +433,9 @@ typedef bn_st *bn_t;
  * @param[in] A				- the first multiple precision integer to multiply.
  * @param[in] B				- the second multiple precision integer to multiply.
  */
-#if BN_KARAT > 0
+#if BN_MUL == ADAPT
+#define bn_mul(C, A, B)		bn_mul_adapt(C, A, B)
+#elif BN_KARAT > 0
 #define bn_mul(C, A, B)		bn_mul_karat(C, A, B)
 #elif BN_MUL == BASIC
 #define bn_mul(C, A, B)		bn_mul_basic(C, A, B)
@@ -266,7 +449,9 @@ typedef bn_st *bn_t;
  * @param[out] C			- the result.
  * @param[in] A				- the multiple precision integer to square.
  */
-#if BN_KARAT > 0
+#if BN_SQR == ADAPT
+#define bn_sqr(C, A)		bn_sqr_adapt(C, A)
+#elif BN_KARAT > 0
 #define bn_sqr(C, A)		bn_sqr_karat(C, A)
 #elif BN_SQR == BASIC
 #define bn_sqr(C, A)		bn_sqr_basic(C, A)
@@ -337,7 +522,7 @@ typedef bn_st *bn_t;
  */
 #if BN_MUL == BASIC
 #define bn_mod_monty(C, A, M, U)	bn_mod_monty_basic(C, A, M, U)
-#elif BN_MUL == COMBA
+#elif BN_MUL == COMBA || BN_MUL == ADAPT
 #define bn_mod_monty(C, A, M, U)	bn_mod_monty_comba(C, A, M, U)
 #endif
 
@@ -776,6 +961,37 @@ void bn_mul_comba(bn_t c, const bn_t a, const bn_t b);
  */
 void bn_mul_karat(bn_t c, const bn_t a, const bn_t b);
 
+/**
+ * Multiplies two multiple precision integers using Toom-3 multiplication,
+ * splitting the operands in three pieces.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer.
+ * @param[in] b				- the second multiple precision integer.
+ */
+void bn_mul_toom3(bn_t c, const bn_t a, const bn_t b);
+
+/**
+ * Multiplies two multiple precision integers using number-theoretic transforms
+ * modulo three word-sized primes and the Chinese Remainder Theorem.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer.
+ * @param[in] b				- the second multiple precision integer.
+ * @throw ERR_NO_PRECI		- if the product does not fit in the transform.
+ */
+void bn_mul_ntt(bn_t c, const bn_t a, const bn_t b);
+
+/**
+ * Multiplies two multiple precision integers choosing the method by the size
+ * of the operands, as configured by BN_TOOM3 and BN_KARAT.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer.
+ * @param[in] b				- the second multiple precision integer.
+ */
+void bn_mul_adapt(bn_t c, const bn_t a, const bn_t b);
+
 /**
  * Computes the square of a multiple precision integer using Schoolbook
  * squaring.
@@ -801,6 +1017,15 @@ void bn_sqr_comba(bn_t c, const bn_t a);
  */
 void bn_sqr_karat(bn_t c, const bn_t a);
 
+/**
+ * Computes the square of a multiple precision integer choosing the method by
+ * the size of the operand, as configured by BN_TOOM3 and BN_KARAT.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to square.
+ */
+void bn_sqr_adapt(bn_t c, const bn_t a);
+
 /**
  * Doubles a multiple precision. Computes c = a + a.
  *
@@ -961,6 +1186,53 @@ void bn_mod_monty_conv(bn_t c, const bn_t a, const bn_t m);
  */
 void bn_mod_monty_back(bn_t c, const bn_t a, const bn_t m);
 
+/**
+ * Prepares a Montgomery arithmetic context for an odd modulus.
+ *
+ * @param[out] ctx			- the context.
+ * @param[in] m				- the modulus.
+ */
+void bn_mont_set(bn_mont_t ctx, const bn_t m);
+
+/**
+ * Converts a multiple precision integer to Montgomery form.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to convert.
+ * @param[in] ctx			- the Montgomery arithmetic context.
+ */
+void bn_mont_conv(bn_t c, const bn_t a, const bn_mont_t ctx);
+
+/**
+ * Converts a multiple precision integer from Montgomery form.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to convert.
+ * @param[in] ctx			- the Montgomery arithmetic context.
+ */
+void bn_mont_back(bn_t c, const bn_t a, const bn_mont_t ctx);
+
+/**
+ * Multiplies two multiple precision integers in Montgomery form. Computes
+ * c = a * b * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer to multiply.
+ * @param[in] b				- the second multiple precision integer to multiply.
+ * @param[in] ctx			- the Montgomery arithmetic context.
+ */
+void bn_mont_mul(bn_t c, const bn_t a, const bn_t b, const bn_mont_t ctx);
+
+/**
+ * Squares a multiple precision integer in Montgomery form. Computes
+ * c = a^2 * R^(-1) mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to square.
+ * @param[in] ctx			- the Montgomery arithmetic context.
+ */
+void bn_mont_sqr(bn_t c, const bn_t a, const bn_mont_t ctx);
+
 /**
  * Reduces a multiple precision integer modulo a modulus using Montgomery
  * reduction with Schoolbook multiplication.
@@ -1035,6 +1307,22 @@ void bn_mxp_slide(bn_t c, const bn_t a, const bn_t b, const bn_t m);
  */
 void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m);
 
+/**
+ * Exponentiates a multiple precision integer modulo an odd modulus using a
+ * constant-time fixed window method. The precomputed powers are stored with
+ * interleaved digits and read in full, and the Montgomery arithmetic works on
+ * vectors as long as the modulus with masked final subtractions, so neither
+ * the sequence of operations nor the memory access pattern depends on the
+ * basis or the exponent.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_PRECI		- if the modulus is larger than the precision.
+ */
+void bn_mxp_consttime(bn_t c, const bn_t a, const bn_t b, const bn_t m);
+
 /**
  * Exponentiates a multiple precision integer by a small power modulo a modulus
  * using the binary method.
@@ -1046,6 +1334,88 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m);
  */
 void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m);
 
+/**
+ * Exponentiates a multiple precision integer in Montgomery form using the
+ * sliding window method. The basis and the result stay in Montgomery form.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @param[in] ctx			- the Montgomery arithmetic context.
+ */
+void bn_mont_mxp(bn_t c, const bn_t a, const bn_t b, const bn_mont_t ctx);
+
+/**
+ * Exponentiates a multiple precision integer modulo the modulus of a
+ * Montgomery context, with the same constant-time method as
+ * bn_mxp_consttime(). Unlike bn_mont_mxp(), the basis and the result are not
+ * in Montgomery form, so that the conversions also run in constant time.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @param[in] ctx			- the Montgomery arithmetic context.
+ * @throw ERR_NO_PRECI		- if the modulus is larger than the precision.
+ */
+void bn_mont_mxp_consttime(bn_t c, const bn_t a, const bn_t b,
+		const bn_mont_t ctx);
+
+/**
+ * Builds a precomputation table for exponentiating a fixed basis modulo a
+ * modulus using the single-table comb method. The table must hold BN_TABLE
+ * initialized integers.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] a				- the basis.
+ * @param[in] bits			- the maximum length in bits of the exponents.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_pre(bn_t *t, const bn_t a, int bits, const bn_t m);
+
+/**
+ * Exponentiates a fixed basis modulo a modulus using the single-table comb
+ * method and a table built by bn_mxp_pre() for the same modulus and the same
+ * exponent length.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] b				- the exponent.
+ * @param[in] bits			- the length in bits given to bn_mxp_pre().
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the exponent is longer than the table allows.
+ */
+void bn_mxp_fix(bn_t c, const bn_t *t, const bn_t b, int bits,
+		const bn_t m);
+
+/**
+ * Exponentiates two multiple precision integers simultaneously modulo a
+ * modulus by interleaving sliding windows. Computes C = A^B * D^E mod M.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first basis.
+ * @param[in] b				- the first exponent.
+ * @param[in] d				- the second basis.
+ * @param[in] e				- the second exponent.
+ * @param[in] m				- the modulus.
+ */
+void bn_mxp_sim(bn_t c, const bn_t a, const bn_t b, const bn_t d,
+		const bn_t e, const bn_t m);
+
+/**
+ * Exponentiates many multiple precision integers simultaneously modulo a
+ * modulus by interleaving sliding windows. Computes C = prod_i A[i]^B[i] mod M.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponents.
+ * @param[in] m				- the modulus.
+ * @param[in] n				- the number of bases.
+ * @throw ERR_NO_VALID		- if the number of bases is not positive.
+ * @throw ERR_NO_MEMORY		- if the tables cannot be allocated.
+ */
+void bn_mxp_sim_lot(bn_t c, const bn_t a[], const bn_t b[], const bn_t m,
+		int n);
+
 /**
  * Computes the greatest common divisor of two multiple precision integers
  * using the standard Euclidean algorithm.
@@ -1149,6 +1519,20 @@ void bn_gcd_ext_mid(bn_t c, bn_t d, bn_t e, bn_t f, const bn_t a, const bn_t b);
  */
 void bn_gcd_ext_dig(bn_t c, bn_t d, bn_t e, const bn_t a, dig_t b);
 
+/**
+ * Computes the multiplicative inverse of a multiple precision integer modulo
+ * an odd modulus with the divsteps algorithm of Bernstein and Yang. The number
+ * of iterations and the sequence of operations depend only on the size of the
+ * modulus, so the function is suitable for secret operands.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to invert.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is not odd and positive or the
+ * 							integer is not invertible.
+ */
+void bn_mod_inv_const(bn_t c, const bn_t a, const bn_t m);
+
 /**
  * Computes the last common multiple of two multiple precision integers.
  * Computes c = lcm(a, b).
@@ -1245,6 +1629,17 @@ void bn_gen_prime_safep(bn_t a, int bits);
  */
 void bn_gen_prime_stron(bn_t a, int bits);
 
+/**
+ * Generates two distinct probable prime numbers of the same length. The
+ * candidates are searched incrementally from random starting points by
+ * CORES threads if multithreading is enabled.
+ *
+ * @param[out] a			- the first prime.
+ * @param[out] b			- the second prime.
+ * @param[in] bits			- the length of the numbers in bits.
+ */
+void bn_gen_prime_par(bn_t a, bn_t b, int bits);
+
 /**
  * Tries to factorize an integer using Pollard (p - 1) factoring algorithm.
  * The maximum length of the returned factor is 16 bits.
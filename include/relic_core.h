@@ -49,6 +49,7 @@
 #include "relic_bench.h"
 #include "relic_rand.h"
 #include "relic_pool.h"
+#include "relic_arena.h"
 #include "relic_label.h"
 
 #ifdef MULTI
@@ -138,6 +139,87 @@
 /* Type definitions                                                           */
 /*============================================================================*/
 
+#ifdef WITH_FB
+/**
+ * Precomputation tables of the binary field. The tables are allocated apart
+ * from the library context, so that contexts configured with the same
+ * polynomial can reference a single copy.
+ */
+typedef struct {
+	/** The number of library contexts referencing the tables. */
+	int refs;
+#if FB_SLV == QUICK || !defined(STRIP)
+	/** Table of precomputed half-traces. */
+	fb_st fb_half[(FB_DIGIT / 8 + 1) * FB_DIGS][16];
+#endif /* FB_SLV == QUICK */
+#if (FB_SRT == QUICK || !defined(STRIP)) && defined(FB_PRECO)
+	/** Multiplication table for the z^(1/2). */
+	fb_st fb_tab_srz[256];
+#endif /* FB_SRT == QUICK */
+#if FB_INV == ITOHT || !defined(STRIP)
+	/** Tables for repeated squarings. */
+	fb_st fb_tab_sqr[MAX_TERMS][FB_TABLE];
+	/** Pointers to the elements in the tables of repeated squarings. */
+	fb_st *fb_tab_ptr[MAX_TERMS][FB_TABLE];
+#endif /* FB_INV == ITOHT */
+} fb_tab_t;
+#endif /* WITH_FB */
+
+#if defined(WITH_EB) && defined(EB_PRECO)
+/**
+ * Precomputation table for binary elliptic curve generator multiplication.
+ */
+typedef struct {
+	/** The number of library contexts referencing the table. */
+	int refs;
+	/** Precomputation table for generator multiplication. */
+	eb_st eb_pre[EB_TABLE];
+	/** Array of pointers to the precomputation table. */
+	eb_st *eb_ptr[EB_TABLE];
+#if ALLOC == STATIC
+	/** The coordinates of the precomputed points. */
+	fb_st _eb_pre[3 * EB_TABLE];
+#endif
+} eb_tab_t;
+#endif /* WITH_EB && EB_PRECO */
+
+#if defined(WITH_EP) && defined(EP_PRECO)
+/**
+ * Precomputation table for prime elliptic curve generator multiplication.
+ */
+typedef struct {
+	/** The number of library contexts referencing the table. */
+	int refs;
+	/** Precomputation table for generator multiplication. */
+	ep_st ep_pre[EP_TABLE];
+	/** Array of pointers to the precomputation table. */
+	ep_st *ep_ptr[EP_TABLE];
+#if ALLOC == STATIC
+	/** The coordinates of the precomputed points. */
+	fp_st _ep_pre[3 * EP_TABLE];
+#endif
+} ep_tab_t;
+#endif /* WITH_EP && EP_PRECO */
+
+#if defined(WITH_EPX) && defined(EP_PRECO)
+/**
+ * Precomputation table for generator multiplication in prime elliptic curves
+ * over quadratic extensions.
+ */
+typedef struct {
+	/** The number of library contexts referencing the table. */
+	int refs;
+	/** Precomputation table for generator multiplication. */
+	ep2_st ep2_pre[EP_TABLE];
+	/** Array of pointers to the precomputation table. */
+	ep2_st *ep2_ptr[EP_TABLE];
+#if ALLOC != AUTO
+	/** The coordinates of the precomputed points. */
+	fp2_st _ep2_pre[3 * EP_TABLE];
+#endif
+} ep2_tab_t;
+#endif /* WITH_EPX && EP_PRECO */
+
 /**
  * Library context.
  */
@@ -145,6 +227,9 @@ typedef struct _ctx_t {
 	/** The value returned by the last call, can be STS_OK or STS_ERR. */
 	int code;
 
+	/** The shared context published by this context, if any. */
+	void *shared;
+
 #ifdef CHECK
 	/** The state of the last error caught. */
 	sts_t *last;
@@ -164,12 +249,32 @@ typedef struct _ctx_t {
 #endif /* CHECK || TRACE */
 
 #if ALLOC == STATIC
+#ifdef SHARE
+	/** The digit vectors cached from the shared pool. */
+	dig_t *magaz[POOL_MAGAZ];
+	/** The number of cached digit vectors. */
+	int count;
+#else
 	/** The static pool of digit vectors. */
 	pool_t pool[POOL_SIZE];
-	/** The index of the next free digit vector in the pool. */
+	/** The index of the top of the stack of free digit vectors. */
 	int next;
+	/** The number of digit vectors in the pool ever handed out. */
+	int used;
+#endif
 #endif /* ALLOC == STATIC */
 
+#if ALLOC == ARENA
+	/** The first block of memory reserved by the arena. */
+	arena_t *arena;
+	/** The block of memory currently used by the arena. */
+	arena_t *arena_blk;
+	/** The number of bytes already used in the current block. */
+	size_t arena_top;
+	/** The innermost open scope, or NULL if no scope is open. */
+	void *arena_mark;
+#endif /* ALLOC == ARENA */
+
 #ifdef WITH_FB
 	/** Identifier of the currently configured binary field. */
 	int fb_id;
@@ -183,28 +288,18 @@ typedef struct _ctx_t {
 	/** Powers of z with non-zero traces. */
 	int fb_ta, fb_tb, fb_tc;
 #endif /* FB_TRC == QUICK */
-#if FB_SLV == QUICK || !defined(STRIP)
-	/** Table of precomputed half-traces. */
-	fb_st fb_half[(FB_DIGIT / 8 + 1) * FB_DIGS][16];
-#endif /* FB_SLV == QUICK */
 #if FB_SRT == QUICK || !defined(STRIP)
 	/** Square root of z. */
 	fb_st fb_srz;
-#ifdef FB_PRECO
-	/** Multiplication table for the z^(1/2). */
-	fb_st fb_tab_srz[256];
-#endif /* FB_PRECO */
 #endif /* FB_SRT == QUICK */
 #if FB_INV == ITOHT || !defined(STRIP)
 	/** Stores an addition chain for (FB_BITS - 1). */
 	int chain[MAX_TERMS + 1];
 	/** Stores the length of the addition chain. */
 	int chain_len;
-	/** Tables for repeated squarings. */
-	fb_st fb_tab_sqr[MAX_TERMS][FB_TABLE];
-	/** Pointers to the elements in the tables of repeated squarings. */
-	fb_st *fb_tab_ptr[MAX_TERMS][FB_TABLE];
 #endif /* FB_INV == ITOHT */
+	/** Precomputation tables of the binary field, possibly shared. */
+	fb_tab_t *fb_tab;
 #endif /* WITH_FB */
 
 #ifdef WITH_EB
@@ -235,10 +330,8 @@ typedef struct _ctx_t {
 	/** Flag that stores if the binary curve has efficient endomorphisms. */
 	int eb_is_kbltz;
 #ifdef EB_PRECO
-	/** Precomputation table for generator multiplication. */
-	eb_st eb_pre[EB_TABLE];
-	/** Array of pointers to the precomputation table. */
-	eb_st *eb_ptr[EB_TABLE];
+	/** Precomputation table for generator multiplication, possibly shared. */
+	eb_tab_t *eb_tab;
 #endif /* EB_PRECO */
 #endif /* WITH_EB */
 
@@ -265,6 +358,8 @@ typedef struct _ctx_t {
 	int sps[MAX_TERMS + 1];
 	/** Length of sparse prime representation. */
 	int sps_len;
+	/** Addition chains for the fixed exponents of the prime field. */
+	fp_chain_t fp_chains[FP_CHAINS];
 #endif /* WITH_FP */
 
 #ifdef WITH_EP
@@ -298,17 +393,15 @@ typedef struct _ctx_t {
 	/** Flag that stores if the prime curve is supersingular. */
 	int ep_is_super;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication. */
-	ep_st ep_pre[EP_TABLE];
-	/** Array of pointers to the precomputation table. */
-	ep_st *ep_ptr[EP_TABLE];
+	/** Precomputation table for generator multiplication, possibly shared. */
+	ep_tab_t *ep_tab;
 #endif /* EP_PRECO */
 #endif /* WITH_EP */
 
 #ifdef WITH_EPX
 	/** The generator of the elliptic curve. */
 	ep2_st ep2_g;
-#if ALLOC == STATIC || ALLOC == DYNAMIC || ALLOC == STACK
+#if ALLOC == STATIC || ALLOC == DYNAMIC || ALLOC == STACK || ALLOC == ARENA
 	/** The first coordinate of the generator. */
 	fp2_st ep2_gx;
 	/** The second coordinate of the generator. */
@@ -327,15 +420,9 @@ typedef struct _ctx_t {
 	/** Flag that stores if the prime curve is a twist. */
 	int ep2_is_twist;
 #ifdef EP_PRECO
-	/** Precomputation table for generator multiplication.*/
-	ep2_st ep2_pre[EP_TABLE];
-	/** Array of pointers to the precomputation table. */
-	ep2_st *ep2_ptr[EP_TABLE];
+	/** Precomputation table for generator multiplication, possibly shared. */
+	ep2_tab_t *ep2_tab;
 #endif /* EP_PRECO */
-#if ALLOC == STACK
-/** In case of stack allocation, we need to get global memory for the table. */
-	fp2_st _ep2_pre[3 * EP_TABLE];
-#endif /* ALLOC == STACK */
 #endif /* WITH_EPX */
 
 #ifdef WITH_PP
@@ -428,4 +515,53 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Publishes the configuration of the current library context so that other
+ * threads can attach to it. The parameters are copied once, while the
+ * precomputation tables are referenced instead of copied. The copy is
+ * released when the current context is finalized or publishes again.
+ *
+ * @return STS_OK if no error occurs, STS_ERR otherwise.
+ */
+int core_share(void);
+
+/**
+ * Initializes the library context of the calling thread with the
+ * configuration published by core_share(), instead of calling core_init()
+ * and configuring parameters again. Only the parameters are copied; the
+ * precomputation tables are referenced until parameters are changed in this
+ * thread.
+ *
+ * @return STS_OK if no error occurs, STS_ERR otherwise.
+ */
+int core_attach(void);
+
+/**
+ * Returns a precomputation table that the current library context can write.
+ * If the table is referenced by other contexts, the reference is released and
+ * a new table filled with zeros is allocated. Tables start with their
+ * reference counter.
+ *
+ * @param[in] tab				- the table, or NULL.
+ * @param[in] size				- the size of the table in bytes.
+ * @return the table, or NULL if there is no available memory.
+ */
+void *core_tab_own(void *tab, size_t size);
+
+/**
+ * Acquires a reference to a precomputation table.
+ *
+ * @param[in] tab				- the table, or NULL.
+ * @return the table.
+ */
+void *core_tab_ref(void *tab);
+
+/**
+ * Releases a reference to a precomputation table. The table is freed when no
+ * library context references it.
+ *
+ * @param[in] tab				- the table, or NULL.
+ */
+void core_tab_free(void *tab);
+
 #endif /* !RELIC_CORE_H */
@@ -71,6 +71,11 @@
  */
 #define CP_PKCS2	2
 
+/**
+ * Size in bits of the random exponents used in batch verification.
+ */
+#define CP_BATCH	64
+
 /*============================================================================*/
 /* Type definitions.                                                          */
 /*============================================================================*/
@@ -218,6 +223,29 @@ typedef sokaka_st *sokaka_t;
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
 
+#elif ALLOC == ARENA
+#define rsa_new(A)															\
+	A = (rsa_t)arena_get(sizeof(rsa_st));									\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_null((A)->e);														\
+	bn_null((A)->n);														\
+	bn_null((A)->d);														\
+	bn_null((A)->dp);														\
+	bn_null((A)->dq);														\
+	bn_null((A)->p);														\
+	bn_null((A)->q);														\
+	bn_null((A)->qi);														\
+	bn_new((A)->e);															\
+	bn_new((A)->n);															\
+	bn_new((A)->d);															\
+	bn_new((A)->dp);														\
+	bn_new((A)->dq);														\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->qi);														\
+
 #elif ALLOC == STATIC
 #define rsa_new(A)															\
 	A = (rsa_t)alloca(sizeof(rsa_st));										\
@@ -286,6 +314,21 @@ typedef sokaka_st *sokaka_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == ARENA
+#define rsa_free(A)															\
+	if (A != NULL) {														\
+		bn_free((A)->e);													\
+		bn_free((A)->n);													\
+		bn_free((A)->d);													\
+		bn_free((A)->dp);													\
+		bn_free((A)->dq);													\
+		bn_free((A)->p);													\
+		bn_free((A)->q);													\
+		bn_free((A)->qi);													\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STATIC
 #define rsa_free(A)															\
 	if (A != NULL) {														\
@@ -345,6 +388,18 @@ typedef sokaka_st *sokaka_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 
+#elif ALLOC == ARENA
+#define rabin_new(A)														\
+	A = (rabin_t)arena_get(sizeof(rabin_st));								\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_new((A)->n);															\
+	bn_new((A)->dp);														\
+	bn_new((A)->dq);														\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+
 #elif ALLOC == STATIC
 #define rabin_new(A)														\
 	A = (rabin_t)alloca(sizeof(rabin_st));									\
@@ -393,6 +448,18 @@ typedef sokaka_st *sokaka_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == ARENA
+#define rabin_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->n);													\
+		bn_free((A)->dp);													\
+		bn_free((A)->dq);													\
+		bn_free((A)->p);													\
+		bn_free((A)->q);													\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STATIC
 #define rabin_free(A)														\
 	if (A != NULL) {														\
@@ -446,6 +513,18 @@ typedef sokaka_st *sokaka_t;
 	bn_new((A)->q);															\
 	(A)->t = 0;																\
 
+#elif ALLOC == ARENA
+#define bdpe_new(A)															\
+	A = (bdpe_t)arena_get(sizeof(bdpe_st));									\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_new((A)->n);															\
+	bn_new((A)->y);															\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	(A)->t = 0;																\
+
 #elif ALLOC == STATIC
 #define bdpe_new(A)															\
 	A = (bdpe_t)alloca(sizeof(bdpe_st));									\
@@ -493,6 +572,18 @@ typedef sokaka_st *sokaka_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == ARENA
+#define bdpe_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->n);													\
+		bn_free((A)->y);													\
+		bn_free((A)->p);													\
+		bn_free((A)->q);													\
+		(A)->t = 0;															\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STATIC
 #define bdpe_free(A)														\
 	if (A != NULL) {														\
@@ -543,6 +634,15 @@ typedef sokaka_st *sokaka_t;
 	g1_new((A)->s1);														\
 	g2_new((A)->s2);														\
 
+#elif ALLOC == ARENA
+#define sokaka_new(A)														\
+	A = (sokaka_t)arena_get(sizeof(sokaka_st));								\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	g1_new((A)->s1);														\
+	g2_new((A)->s2);														\
+
 #elif ALLOC == STATIC
 #define sokaka_new(A)														\
 	A = (sokaka_t)alloca(sizeof(sokaka_st));								\
@@ -577,6 +677,15 @@ typedef sokaka_st *sokaka_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == ARENA
+#define sokaka_free(A)														\
+	if (A != NULL) {														\
+		g1_free((A)->s1);													\
+		g2_free((A)->s2);													\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STATIC
 #define sokaka_free(A)														\
 	if (A != NULL) {														\
@@ -735,6 +844,42 @@ int cp_rsa_sig_basic(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len,
 int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len,
 		int hash, rsa_t prv);
 
+/**
+ * Decrypts many ciphertexts under the same private key using the fast RSA
+ * decryption with CRT optimization. The Montgomery contexts of the two primes
+ * are computed once for the whole batch, and the ciphertexts are spread among
+ * CORES threads if multithreading is enabled.
+ *
+ * @param[out] out			- the output buffers.
+ * @param[in, out] out_len	- the buffer capacities and numbers of bytes written.
+ * @param[in] in			- the input buffers.
+ * @param[in] in_len		- the numbers of bytes to decrypt.
+ * @param[in] n				- the number of ciphertexts.
+ * @param[in] prv			- the private key.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int cp_rsa_dec_batch(uint8_t *out[], int out_len[], uint8_t *in[],
+		int in_len[], int n, rsa_t prv);
+
+/**
+ * Signs many messages under the same private key using the fast RSA signature
+ * algorithm with CRT optimization. The Montgomery contexts of the two primes
+ * are computed once for the whole batch, and the messages are spread among
+ * CORES threads if multithreading is enabled. The flag must be non-zero if the
+ * messages being signed are already hash values.
+ *
+ * @param[out] sig			- the signatures.
+ * @param[in, out] sig_len	- the buffer capacities and numbers of bytes written.
+ * @param[in] msg			- the messages to sign.
+ * @param[in] msg_len		- the numbers of bytes to sign.
+ * @param[in] n				- the number of messages.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] prv			- the private key.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int cp_rsa_sig_batch(uint8_t *sig[], int sig_len[], uint8_t *msg[],
+		int msg_len[], int n, int hash, rsa_t prv);
+
 /**
  * Verifies an RSA signature. The flag must be non-zero if the message being
  * signed is already a hash value.
@@ -1061,6 +1206,43 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q);
 
+/**
+ * Aggregates a set of BLS signatures into a single signature.
+ *
+ * @param[out] s				- the aggregated signature.
+ * @param[in] sig				- the signatures to aggregate.
+ * @param[in] n					- the number of signatures.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int cp_bls_agg(g1_t s, g1_t *sig, int n);
+
+/**
+ * Verifies an aggregated BLS signature on a set of distinct messages. The
+ * aggregate is rejected if two messages are equal, since otherwise a rogue
+ * public key could forge it.
+ *
+ * @param[in] s					- the aggregated signature.
+ * @param[in] msg				- the signed messages.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] q					- the public keys.
+ * @param[in] n					- the number of messages.
+ * @return a boolean value indicating the verification result.
+ */
+int cp_bls_ver_agg(g1_t s, uint8_t **msg, int *len, g2_t *q, int n);
+
+/**
+ * Verifies a batch of messages signed with BLS using random small exponents,
+ * at the cost of a single product of n + 1 pairings.
+ *
+ * @param[in] s					- the signatures.
+ * @param[in] msg				- the signed messages.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] q					- the public keys.
+ * @param[in] n					- the number of signatures.
+ * @return a boolean value indicating if all the signatures are valid.
+ */
+int cp_bls_ver_batch(g1_t *s, uint8_t **msg, int *len, g2_t *q, int n);
+
 /**
  * Generates a Boneh-Boyen key pair.
  *
@@ -113,6 +113,8 @@ typedef dig_t *dv_t;
  */
 #if ALLOC == DYNAMIC
 #define dv_new(A)			dv_new_dynam(&(A), DV_DIGS)
+#elif ALLOC == ARENA
+#define dv_new(A)			dv_new_arena(&(A), DV_DIGS)
 #elif ALLOC == STATIC
 #define dv_new(A)			dv_new_statc(&(A), DV_DIGS)
 #elif ALLOC == AUTO
@@ -131,6 +133,8 @@ typedef dig_t *dv_t;
  */
 #if ALLOC == DYNAMIC
 #define dv_free(A)			dv_free_dynam(&(A))
+#elif ALLOC == ARENA
+#define dv_free(A)			dv_free_arena(&(A))
 #elif ALLOC == STATIC
 #define dv_free(A)			dv_free_statc(&(A))
 #elif ALLOC == AUTO
@@ -209,6 +213,8 @@ int dv_cmp_const(const dig_t *a, const dig_t *b, int size);
  */
 #if ALLOC == DYNAMIC
 void dv_new_dynam(dv_t *a, int digits);
+#elif ALLOC == ARENA
+void dv_new_arena(dv_t *a, int digits);
 #elif ALLOC == STATIC
 void dv_new_statc(dv_t *a, int digits);
 #endif
@@ -220,6 +226,8 @@ void dv_new_statc(dv_t *a, int digits);
  */
 #if ALLOC == DYNAMIC
 void dv_free_dynam(dv_t *a);
+#elif ALLOC == ARENA
+void dv_free_arena(dv_t *a);
 #elif ALLOC == STATIC
 void dv_free_statc(dv_t *a);
 #endif
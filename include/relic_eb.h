@@ -149,7 +149,7 @@ typedef struct {
 	fb_t y;
 	/** The third coordinate (projective representation). */
 	fb_t z;
-#elif ALLOC == DYNAMIC || ALLOC == STACK || ALLOC == AUTO
+#elif ALLOC == DYNAMIC || ALLOC == STACK || ALLOC == AUTO || ALLOC == ARENA
 	/** The first coordinate. */
 	fb_st x;
 	/** The second coordinate. */
@@ -198,6 +198,13 @@ typedef eb_st *eb_t;
 		THROW(ERR_NO_MEMORY);												\
 	}																		\
 
+#elif ALLOC == ARENA
+#define eb_new(A)															\
+	A = (eb_t)arena_get(sizeof(eb_st));										\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+
 #elif ALLOC == STATIC
 #define eb_new(A)															\
 	A = (eb_t)alloca(sizeof(eb_st));										\
@@ -232,6 +239,13 @@ typedef eb_st *eb_t;
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == ARENA
+#define eb_free(A)															\
+	if (A != NULL) {														\
+		arena_put(A);														\
+		A = NULL;															\
+	}																		\
+
 #elif ALLOC == STATIC
 #define eb_free(A)															\
 	if (A != NULL) {														\
@@ -995,6 +1009,17 @@ void eb_mul_sim_joint(eb_t r, const eb_t p, const bn_t k, const eb_t q,
  */
 void eb_mul_sim_gen(eb_t r, const bn_t k, const eb_t q, const bn_t m);
 
+/**
+ * Multiplies and adds many binary elliptic curve points simultaneously.
+ * Computes R = sum_i k[i]P[i], using tau-adic expansions on Koblitz curves.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+void eb_mul_sim_lot(eb_t r, const eb_t p[], const bn_t k[], int n);
+
 /**
  * Converts a point to affine coordinates.
  *
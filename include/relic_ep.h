@@ -186,7 +186,7 @@ typedef struct {
 	fp_t y;
 	/** The third coordinate (projective representation). */
 	fp_t z;
-#elif ALLOC == DYNAMIC || ALLOC == STACK || ALLOC == AUTO
+#elif ALLOC == DYNAMIC || ALLOC == STACK || ALLOC == AUTO || ALLOC == ARENA
 	/** The first coordinate. */
 	fp_st x;
 	/** The second coordinate. */
@@ -235,6 +235,13 @@ typedef ep_st *ep_t;
 		THROW(ERR_NO_MEMORY);												\
 	}																		\
 
+#elif ALLOC == ARENA
+#define ep_new(A)															\
+	A = (ep_t)arena_get(sizeof(ep_st));										\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+
 #elif ALLOC == STATIC
 #define ep_new(A)															\
 	A = (ep_t)alloca(sizeof(ep_st));										\
@@ -269,6 +276,13 @@ typedef ep_st *ep_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == ARENA
+#define ep_free(A)															\
+	if (A != NULL) {														\
+		arena_put(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STATIC
 #define ep_free(A)															\
 	if (A != NULL) {														\
@@ -353,6 +367,8 @@ typedef ep_st *ep_t;
 #define ep_mul(R, P, K)		ep_mul_monty(R, P, K)
 #elif EP_MUL == LWNAF
 #define ep_mul(R, P, K)		ep_mul_lwnaf(R, P, K)
+#elif EP_MUL == LWREG
+#define ep_mul(R, P, K)		ep_mul_lwreg(R, P, K)
 #endif
 
 /**
@@ -1059,6 +1075,18 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
  */
 void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m);
 
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously.
+ * Computes R = sum_i k[i]P[i], interleaving w-NAFs for a few points and
+ * accumulating points in buckets for many points.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n);
+
 /**
  * Converts a point to affine coordinates.
  *
@@ -188,6 +188,19 @@ typedef ep3_st *ep3_t;
 	fp2_new((A)->y);														\
 	fp2_new((A)->z);														\
 
+#elif ALLOC == ARENA
+#define ep2_new(A)															\
+	A = (ep2_t)arena_get(sizeof(ep2_st));									\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	fp2_null((A)->x);														\
+	fp2_null((A)->y);														\
+	fp2_null((A)->z);														\
+	fp2_new((A)->x);														\
+	fp2_new((A)->y);														\
+	fp2_new((A)->z);														\
+
 #elif ALLOC == STATIC
 #define ep2_new(A)															\
 	A = (ep2_t)alloca(sizeof(ep2_st));										\
@@ -228,6 +241,16 @@ typedef ep3_st *ep3_t;
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == ARENA
+#define ep2_free(A)															\
+	if (A != NULL) {														\
+		fp2_free((A)->x);													\
+		fp2_free((A)->y);													\
+		fp2_free((A)->z);													\
+		arena_put(A);														\
+		A = NULL;															\
+	}																		\
+
 #elif ALLOC == STATIC
 #define ep2_free(A)															\
 	if (A != NULL) {														\
@@ -296,6 +319,26 @@ typedef ep3_st *ep3_t;
 #define ep2_dbl(R, P)			ep2_dbl_projc(R, P);
 #endif
 
+/**
+ * Multiplies a point in an elliptic curve over a quadratic extension field by
+ * an integer. Computes R = kP.
+ *
+ * @param[out] R				- the result.
+ * @param[in] P					- the point to multiply.
+ * @param[in] K					- the integer.
+ */
+#if EP_MUL == BASIC
+#define ep2_mul(R, P, K)		ep2_mul_basic(R, P, K)
+#elif EP_MUL == SLIDE
+#define ep2_mul(R, P, K)		ep2_mul_slide(R, P, K)
+#elif EP_MUL == MONTY
+#define ep2_mul(R, P, K)		ep2_mul_monty(R, P, K)
+#elif EP_MUL == LWNAF
+#define ep2_mul(R, P, K)		ep2_mul_lwnaf(R, P, K)
+#elif EP_MUL == LWREG
+#define ep2_mul(R, P, K)		ep2_mul_lwreg(R, P, K)
+#endif
+
 /**
  * Builds a precomputation table for multiplying a fixed prime elliptic point
  * over a quadratic extension.
@@ -657,13 +700,57 @@ void ep2_dbl_projc(ep2_t r, ep2_t p);
 
 /**
  * Multiplies a point in a elliptic curve over a quadratic extension by an
- * integer scalar.
+ * integer using the binary method. This method does not assume that the point
+ * is in the subgroup of prime order.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+void ep2_mul_basic(ep2_t r, ep2_t p, bn_t k);
+
+/**
+ * Multiplies a point in a elliptic curve over a quadratic extension by an
+ * integer using the sliding window method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+void ep2_mul_slide(ep2_t r, ep2_t p, bn_t k);
+
+/**
+ * Multiplies a point in a elliptic curve over a quadratic extension by an
+ * integer using the constant-time Montgomery laddering method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+void ep2_mul_monty(ep2_t r, ep2_t p, bn_t k);
+
+/**
+ * Multiplies a point of prime order in a elliptic curve over a quadratic
+ * extension by an integer using the w-NAF method. On BN and BLS12 curves,
+ * the scalar is decomposed in four parts using the Frobenius endomorphism
+ * (GLS method).
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+void ep2_mul_lwnaf(ep2_t r, ep2_t p, bn_t k);
+
+/**
+ * Multiplies a point of prime order in a elliptic curve over a quadratic
+ * extension by an integer using a regular fixed-window method, performing
+ * the same sequence of operations for every scalar.
  *
  * @param[out] r			- the result.
  * @param[in] p				- the point to multiply.
- * @param[in] k				- the scalar.
+ * @param[in] k				- the integer.
  */
-void ep2_mul(ep2_t r, ep2_t p, bn_t k);
+void ep2_mul_lwreg(ep2_t r, ep2_t p, bn_t k);
 
 /**
  * Multiplies the generator of an elliptic curve over a qaudratic extension.
@@ -850,6 +937,18 @@ void ep2_mul_sim_joint(ep2_t r, ep2_t p, bn_t k, ep2_t q,
  */
 void ep2_mul_sim_gen(ep2_t r, bn_t k, ep2_t q, bn_t l);
 
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously.
+ * Computes R = sum_i k[i]P[i]. On pairing-friendly twists, the scalars are
+ * decomposed with the Frobenius map, so the points must be in G2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep2_mul_sim_lot(ep2_t r, ep2_t p[], bn_t k[], int n);
+
 /**
  * Multiplies a prime elliptic point by a small integer.
  *
@@ -867,6 +966,15 @@ void ep2_mul_dig(ep2_t r, ep2_t p, dig_t k);
  */
 void ep2_norm(ep2_t r, ep2_t p);
 
+/**
+ * Converts multiple points to affine coordinates using a single inversion.
+ *
+ * @param[out] r			- the result.
+ * @param[in] t				- the points to convert.
+ * @param[in] n				- the number of points.
+ */
+void ep2_norm_sim(ep2_t *r, ep2_t *t, int n);
+
 /**
  * Maps a byte array to a point in an elliptic curve over a quadratic extension.
  *
@@ -129,12 +129,35 @@ typedef struct _sts_t {
 	jmp_buf addr;
 	/** Flag to tell if there is a surrounding try-catch block. */
 	int block;
+#if ALLOC == ARENA
+	/** The innermost arena scope open when the block was entered. */
+	void *mark;
+#endif
 } sts_t;
 
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
 
+#if ALLOC == ARENA
+/**
+ * Records the innermost arena scope open when a TRY block is entered.
+ *
+ * @param[out] S		- the state of the block.
+ */
+#define ERR_MARK(S)			(S).mark = core_get()->arena_mark;
+
+/**
+ * Closes the arena scopes left open by the functions an error unwinds.
+ *
+ * @param[in] S			- the state of the block.
+ */
+#define ERR_UNWIND(S)		arena_unwind((S).mark);
+#else
+#define ERR_MARK(S)			/* empty */
+#define ERR_UNWIND(S)		/* empty */
+#endif
+
 /**
  * Implements the TRY clause of the error-handling routines.
  *
@@ -152,6 +175,7 @@ typedef struct _sts_t {
 		ctx_t *_ctx = core_get();										\
 		_last = _ctx->last; 											\
 		_this.block = 1;												\
+		ERR_MARK(_this);												\
 		_ctx->last = &_this; 											\
 		for (int _z = 0; ; _z = 1) 										\
 			if (_z) { 													\
@@ -163,8 +187,9 @@ typedef struct _sts_t {
  *
  * First, the address of the error is stored and the execution resumes
  * on the ERR_TRY macro. If an error is thrown inside the program block,
- * the caught flag is updated and the last error is restored. If some error
- * was caught, the execution is resumed inside the CATCH block.
+ * the caught flag is updated, the arena scopes opened inside the block are
+ * closed and the last error is restored. If some error was caught, the
+ * execution is resumed inside the CATCH block.
  *
  * @param[in] ADDR	- the address of the exception being caught
  */
@@ -173,6 +198,7 @@ typedef struct _sts_t {
 					_ctx->caught = 0; 									\
 				} else {												\
 					_ctx->caught = 1; 									\
+					ERR_UNWIND(_this);									\
 				}														\
 				_ctx->last = _last;										\
 				break; 													\
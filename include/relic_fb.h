@@ -203,6 +203,8 @@ typedef align dig_t fb_st[FB_DIGS + PADDING(FB_BYTES)/(FB_DIGIT / 8)];
  */
 #if ALLOC == DYNAMIC
 #define fb_new(A)			dv_new_dynam((dv_t *)&(A), FB_DIGS)
+#elif ALLOC == ARENA
+#define fb_new(A)			dv_new_arena((dv_t *)&(A), FB_DIGS)
 #elif ALLOC == STATIC
 #define fb_new(A)			dv_new_statc((dv_t *)&(A), FB_DIGS)
 #elif ALLOC == AUTO
@@ -221,6 +223,8 @@ typedef align dig_t fb_st[FB_DIGS + PADDING(FB_BYTES)/(FB_DIGIT / 8)];
  */
 #if ALLOC == DYNAMIC
 #define fb_free(A)			dv_free_dynam((dv_t *)&(A))
+#elif ALLOC == ARENA
+#define fb_free(A)			dv_free_arena((dv_t *)&(A))
 #elif ALLOC == STATIC
 #define fb_free(A)			dv_free_statc((dv_t *)&(A))
 #elif ALLOC == AUTO
@@ -70,6 +70,12 @@
  */
 #define FP_BYTES 	((int)((FP_BITS)/8 + (FP_BITS % 8 > 0)))
 
+/**
+ * Maximum number of prime field multiplications computed at once by the
+ * vectorized kernels.
+ */
+#define FP_LANES	8
+
 /*
  * Finite field identifiers.
  */
@@ -136,6 +142,30 @@ enum {
 #undef FP_SPACE
 #endif
 
+/**
+ * Maximum number of steps of an addition chain for a fixed exponent.
+ */
+#define FP_CHAIN_LEN	(FP_BITS / 4 + 64)
+
+/**
+ * Maximum number of temporary values used by an addition chain.
+ */
+#define FP_CHAIN_REG	48
+
+/**
+ * Identifiers of the fixed exponents evaluated by addition chains.
+ */
+enum {
+	/** Exponent p - 2 for inversion by Fermat's Little Theorem. */
+	FP_CHAIN_INV,
+	/** Exponent (p + 1)/4 for square roots when p = 3 mod 4. */
+	FP_CHAIN_SRT,
+	/** Exponent (p - 1)/2 for computing the Legendre symbol. */
+	FP_CHAIN_LEG,
+	/** Number of fixed exponents. */
+	FP_CHAINS
+};
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -158,6 +188,29 @@ typedef dig_t *fp_t;
  */
 typedef align dig_t fp_st[FP_DIGS + PADDING(FP_BYTES)/(FP_DIGIT / 8)];
 
+/**
+ * Represents an addition chain for a fixed exponent.
+ *
+ * Each step computes r[dst] = r[src]^(2^sqr) * r[mul] over a set of temporary
+ * values, where r[0] holds the basis and the last step produces the power.
+ */
+typedef struct {
+	/** The number of steps. */
+	int len;
+	/** The number of temporary values. */
+	int regs;
+	/** The sign of the exponent. */
+	int sign;
+	/** The temporary value written by each step. */
+	uint8_t dst[FP_CHAIN_LEN];
+	/** The temporary value squared by each step. */
+	uint8_t src[FP_CHAIN_LEN];
+	/** The temporary value multiplied by each step, FP_CHAIN_REG if none. */
+	uint8_t mul[FP_CHAIN_LEN];
+	/** The number of squarings of each step. */
+	int sqr[FP_CHAIN_LEN];
+} fp_chain_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -180,6 +233,8 @@ typedef align dig_t fp_st[FP_DIGS + PADDING(FP_BYTES)/(FP_DIGIT / 8)];
  */
 #if ALLOC == DYNAMIC
 #define fp_new(A)			dv_new_dynam((dv_t *)&(A), FP_DIGS)
+#elif ALLOC == ARENA
+#define fp_new(A)			dv_new_arena((dv_t *)&(A), FP_DIGS)
 #elif ALLOC == STATIC
 #define fp_new(A)			dv_new_statc((dv_t *)&(A), FP_DIGS)
 #elif ALLOC == AUTO
@@ -198,6 +253,8 @@ typedef align dig_t fp_st[FP_DIGS + PADDING(FP_BYTES)/(FP_DIGIT / 8)];
  */
 #if ALLOC == DYNAMIC
 #define fp_free(A)			dv_free_dynam((dv_t *)&(A))
+#elif ALLOC == ARENA
+#define fp_free(A)			dv_free_arena((dv_t *)&(A))
 #elif ALLOC == STATIC
 #define fp_free(A)			dv_free_statc((dv_t *)&(A))
 #elif ALLOC == AUTO
@@ -431,6 +488,14 @@ int fp_prime_get_qnr(void);
  */
 int fp_prime_get_cnr(void);
 
+/**
+ * Returns the addition chain computed for a fixed exponent of the prime field.
+ *
+ * @param[in] id			- the identifier of the exponent.
+ * @return the addition chain.
+ */
+const fp_chain_t *fp_prime_get_chain(int id);
+
 /**
  * Returns the prime field parameter identifier.
  *
@@ -778,6 +843,27 @@ void fp_sub_integ(fp_t c, const fp_t a, const fp_t b);
  */
 void fp_sub_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Adds two double-precision results of prime field multiplications, keeping
+ * the sum below p * 2^(FP_DIGIT * FP_DIGS). Computes c = a + b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first double-precision value to add.
+ * @param[in] b				- the second double-precision value to add.
+ */
+void fp_addc(dv_t c, const dv_t a, const dv_t b);
+
+/**
+ * Subtracts a double-precision result of a prime field multiplication from
+ * another, keeping the difference below p * 2^(FP_DIGIT * FP_DIGS).
+ * Computes c = a - b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the double-precision value.
+ * @param[in] b				- the double-precision value to subtract.
+ */
+void fp_subc(dv_t c, const dv_t a, const dv_t b);
+
 /**
  * Negates a prime field element using basic negation.
  *
@@ -872,6 +958,48 @@ void fp_mul_karat(fp_t c, const fp_t a, const fp_t b);
  */
 void fp_mul_dig(fp_t c, const fp_t a, dig_t b);
 
+/**
+ * Multiplies two prime field elements without modular reduction. The result
+ * can be accumulated with fp_addc(), fp_subc(), fp_mla_unr() or fp_mls_unr()
+ * and reduced once by fp_rdc(). Computes c = a * b.
+ *
+ * @param[out] c			- the double-precision result.
+ * @param[in] a				- the first prime field element to multiply.
+ * @param[in] b				- the second prime field element to multiply.
+ */
+void fp_mul_unr(dv_t c, const fp_t a, const fp_t b);
+
+/**
+ * Multiplies two prime field elements and adds the unreduced product to a
+ * double-precision accumulator. Computes c = c + a * b.
+ *
+ * @param[in,out] c			- the double-precision accumulator.
+ * @param[in] a				- the first prime field element to multiply.
+ * @param[in] b				- the second prime field element to multiply.
+ */
+void fp_mla_unr(dv_t c, const fp_t a, const fp_t b);
+
+/**
+ * Multiplies two prime field elements and subtracts the unreduced product from
+ * a double-precision accumulator. Computes c = c - a * b.
+ *
+ * @param[in,out] c			- the double-precision accumulator.
+ * @param[in] a				- the first prime field element to multiply.
+ * @param[in] b				- the second prime field element to multiply.
+ */
+void fp_mls_unr(dv_t c, const fp_t a, const fp_t b);
+
+/**
+ * Multiplies multiple pairs of prime field elements simultaneously.
+ * Computes c[i] = a[i] * b[i] for 0 <= i < n. Each c[i] may alias a[i] or b[i].
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to multiply.
+ * @param[in] b				- the second prime field elements to multiply.
+ * @param[in] n				- the number of products.
+ */
+void fp_mul_sim(fp_t *c, const fp_t *a, const fp_t *b, int n);
+
 /**
  * Squares a prime field element using Schoolbook squaring.
  *
@@ -905,6 +1033,14 @@ void fp_sqr_integ(fp_t c, const fp_t a);
  */
 void fp_sqr_karat(fp_t c, const fp_t a);
 
+/**
+ * Squares a prime field element without modular reduction. Computes c = a * a.
+ *
+ * @param[out] c			- the double-precision result.
+ * @param[in] a				- the prime field element to square.
+ */
+void fp_sqr_unr(dv_t c, const fp_t a);
+
 /**
  * Shifts a prime field element number to the left. Computes
  * c = a * 2^bits.
@@ -1038,6 +1174,27 @@ void fp_exp_slide(fp_t c, const fp_t a, const bn_t b);
  */
 void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
 
+/**
+ * Generates an addition chain for a fixed exponent, combining sliding windows
+ * with long runs of ones computed as powers x^(2^k - 1). The chain is built
+ * for the absolute value of the exponent, and its sign is recorded apart.
+ *
+ * @param[out] ch			- the addition chain.
+ * @param[in] b				- the exponent.
+ */
+void fp_exp_gen(fp_chain_t *ch, const bn_t b);
+
+/**
+ * Exponentiates a prime field element by a fixed exponent using an addition
+ * chain produced by fp_exp_gen(). A negative exponent is handled by inverting
+ * the result.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] ch			- the addition chain.
+ */
+void fp_exp_chain(fp_t c, const fp_t a, const fp_chain_t *ch);
+
 /**
  * Extracts the square root of a prime field element. Computes c = sqrt(a). The
  * other square root is the negation of c.
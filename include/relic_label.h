@@ -51,21 +51,35 @@
 #undef core_clean
 #undef core_get
 #undef core_set
+#undef core_share
+#undef core_attach
+#undef core_tab_own
+#undef core_tab_ref
+#undef core_tab_free
 
 #define core_init 	PREFIX(core_init)
 #define core_clean 	PREFIX(core_clean)
 #define core_get 	PREFIX(core_get)
 #define core_set 	PREFIX(core_set)
+#define core_share 	PREFIX(core_share)
+#define core_attach 	PREFIX(core_attach)
+#define core_tab_own 	PREFIX(core_tab_own)
+#define core_tab_ref 	PREFIX(core_tab_ref)
+#define core_tab_free 	PREFIX(core_tab_free)
 
 #undef arch_init
 #undef arch_clean
 #undef arch_cycles
 #undef arch_copy_rom
+#undef arch_get_ext
+#undef arch_set_ext
 
 #define arch_init 	PREFIX(arch_init)
 #define arch_clean 	PREFIX(arch_clean)
 #define arch_cycles 	PREFIX(arch_cycles)
 #define arch_copy_rom 	PREFIX(arch_copy_rom)
+#define arch_get_ext 	PREFIX(arch_get_ext)
+#define arch_set_ext 	PREFIX(arch_set_ext)
 
 #undef bench_overhead
 #undef bench_reset
@@ -105,12 +119,34 @@
 #define rand_seed 	PREFIX(rand_seed)
 #define rand_bytes 	PREFIX(rand_bytes)
 
+#undef pool_init
+#undef pool_clean
 #undef pool_get
 #undef pool_put
 
+#define pool_init 	PREFIX(pool_init)
+#define pool_clean 	PREFIX(pool_clean)
 #define pool_get 	PREFIX(pool_get)
 #define pool_put 	PREFIX(pool_put)
 
+#undef arena_open
+#undef arena_close
+#undef arena_init
+#undef arena_clean
+#undef arena_get
+#undef arena_grow
+#undef arena_put
+#undef arena_unwind
+
+#define arena_open 	PREFIX(arena_open)
+#define arena_close 	PREFIX(arena_close)
+#define arena_init 	PREFIX(arena_init)
+#define arena_clean 	PREFIX(arena_clean)
+#define arena_get 	PREFIX(arena_get)
+#define arena_grow 	PREFIX(arena_grow)
+#define arena_put 	PREFIX(arena_put)
+#define arena_unwind 	PREFIX(arena_unwind)
+
 #undef test_fail
 #undef test_pass
 
@@ -154,6 +190,8 @@
 #undef dv_new_statc
 #undef dv_free_dynam
 #undef dv_free_statc
+#undef dv_new_arena
+#undef dv_free_arena
 
 #define dv_print 	PREFIX(dv_print)
 #define dv_zero 	PREFIX(dv_zero)
@@ -165,6 +203,8 @@
 #define dv_new_statc 	PREFIX(dv_new_statc)
 #define dv_free_dynam 	PREFIX(dv_free_dynam)
 #define dv_free_statc 	PREFIX(dv_free_statc)
+#define dv_new_arena 	PREFIX(dv_new_arena)
+#define dv_free_arena 	PREFIX(dv_free_arena)
 
 
 
@@ -213,9 +253,13 @@
 #undef bn_mul_basic
 #undef bn_mul_comba
 #undef bn_mul_karat
+#undef bn_mul_toom3
+#undef bn_mul_ntt
+#undef bn_mul_adapt
 #undef bn_sqr_basic
 #undef bn_sqr_comba
 #undef bn_sqr_karat
+#undef bn_sqr_adapt
 #undef bn_dbl
 #undef bn_hlv
 #undef bn_lsh
@@ -239,7 +283,19 @@
 #undef bn_mxp_basic
 #undef bn_mxp_slide
 #undef bn_mxp_monty
+#undef bn_mxp_consttime
 #undef bn_mxp_dig
+#undef bn_mxp_pre
+#undef bn_mxp_fix
+#undef bn_mxp_sim
+#undef bn_mxp_sim_lot
+#undef bn_mont_set
+#undef bn_mont_conv
+#undef bn_mont_back
+#undef bn_mont_mul
+#undef bn_mont_sqr
+#undef bn_mont_mxp
+#undef bn_mont_mxp_consttime
 #undef bn_gcd_basic
 #undef bn_gcd_lehme
 #undef bn_gcd_stein
@@ -249,6 +305,7 @@
 #undef bn_gcd_ext_stein
 #undef bn_gcd_ext_mid
 #undef bn_gcd_ext_dig
+#undef bn_mod_inv_const
 #undef bn_lcm
 #undef bn_smb_leg
 #undef bn_smb_jac
@@ -260,6 +317,7 @@
 #undef bn_gen_prime_basic
 #undef bn_gen_prime_safep
 #undef bn_gen_prime_stron
+#undef bn_gen_prime_par
 #undef bn_factor
 #undef bn_is_factor
 #undef bn_rec_win
@@ -313,9 +371,13 @@
 #define bn_mul_basic 	PREFIX(bn_mul_basic)
 #define bn_mul_comba 	PREFIX(bn_mul_comba)
 #define bn_mul_karat 	PREFIX(bn_mul_karat)
+#define bn_mul_toom3 	PREFIX(bn_mul_toom3)
+#define bn_mul_ntt 	PREFIX(bn_mul_ntt)
+#define bn_mul_adapt 	PREFIX(bn_mul_adapt)
 #define bn_sqr_basic 	PREFIX(bn_sqr_basic)
 #define bn_sqr_comba 	PREFIX(bn_sqr_comba)
 #define bn_sqr_karat 	PREFIX(bn_sqr_karat)
+#define bn_sqr_adapt 	PREFIX(bn_sqr_adapt)
 #define bn_dbl 	PREFIX(bn_dbl)
 #define bn_hlv 	PREFIX(bn_hlv)
 #define bn_lsh 	PREFIX(bn_lsh)
@@ -339,7 +401,19 @@
 #define bn_mxp_basic 	PREFIX(bn_mxp_basic)
 #define bn_mxp_slide 	PREFIX(bn_mxp_slide)
 #define bn_mxp_monty 	PREFIX(bn_mxp_monty)
+#define bn_mxp_consttime 	PREFIX(bn_mxp_consttime)
 #define bn_mxp_dig 	PREFIX(bn_mxp_dig)
+#define bn_mxp_pre 	PREFIX(bn_mxp_pre)
+#define bn_mxp_fix 	PREFIX(bn_mxp_fix)
+#define bn_mxp_sim 	PREFIX(bn_mxp_sim)
+#define bn_mxp_sim_lot 	PREFIX(bn_mxp_sim_lot)
+#define bn_mont_set 	PREFIX(bn_mont_set)
+#define bn_mont_conv 	PREFIX(bn_mont_conv)
+#define bn_mont_back 	PREFIX(bn_mont_back)
+#define bn_mont_mul 	PREFIX(bn_mont_mul)
+#define bn_mont_sqr 	PREFIX(bn_mont_sqr)
+#define bn_mont_mxp 	PREFIX(bn_mont_mxp)
+#define bn_mont_mxp_consttime 	PREFIX(bn_mont_mxp_consttime)
 #define bn_gcd_basic 	PREFIX(bn_gcd_basic)
 #define bn_gcd_lehme 	PREFIX(bn_gcd_lehme)
 #define bn_gcd_stein 	PREFIX(bn_gcd_stein)
@@ -349,6 +423,7 @@
 #define bn_gcd_ext_stein 	PREFIX(bn_gcd_ext_stein)
 #define bn_gcd_ext_mid 	PREFIX(bn_gcd_ext_mid)
 #define bn_gcd_ext_dig 	PREFIX(bn_gcd_ext_dig)
+#define bn_mod_inv_const 	PREFIX(bn_mod_inv_const)
 #define bn_lcm 	PREFIX(bn_lcm)
 #define bn_smb_leg 	PREFIX(bn_smb_leg)
 #define bn_smb_jac 	PREFIX(bn_smb_jac)
@@ -360,6 +435,7 @@
 #define bn_gen_prime_basic 	PREFIX(bn_gen_prime_basic)
 #define bn_gen_prime_safep 	PREFIX(bn_gen_prime_safep)
 #define bn_gen_prime_stron 	PREFIX(bn_gen_prime_stron)
+#define bn_gen_prime_par 	PREFIX(bn_gen_prime_par)
 #define bn_factor 	PREFIX(bn_factor)
 #define bn_is_factor 	PREFIX(bn_is_factor)
 #define bn_rec_win 	PREFIX(bn_rec_win)
@@ -431,6 +507,7 @@
 #undef fp_prime_get_sps
 #undef fp_prime_get_qnr
 #undef fp_prime_get_cnr
+#undef fp_prime_get_chain
 #undef fp_param_get
 #undef fp_prime_set_dense
 #undef fp_prime_set_pmers
@@ -471,6 +548,8 @@
 #undef fp_sub_basic
 #undef fp_sub_integ
 #undef fp_sub_dig
+#undef fp_addc
+#undef fp_subc
 #undef fp_neg_basic
 #undef fp_neg_integ
 #undef fp_dbl_basic
@@ -482,10 +561,15 @@
 #undef fp_mul_integ
 #undef fp_mul_karat
 #undef fp_mul_dig
+#undef fp_mul_sim
+#undef fp_mul_unr
+#undef fp_mla_unr
+#undef fp_mls_unr
 #undef fp_sqr_basic
 #undef fp_sqr_comba
 #undef fp_sqr_integ
 #undef fp_sqr_karat
+#undef fp_sqr_unr
 #undef fp_lsh
 #undef fp_rsh
 #undef fp_rdc_basic
@@ -501,6 +585,8 @@
 #undef fp_exp_basic
 #undef fp_exp_slide
 #undef fp_exp_monty
+#undef fp_exp_gen
+#undef fp_exp_chain
 #undef fp_srt
 
 #define fp_prime_init 	PREFIX(fp_prime_init)
@@ -512,6 +598,7 @@
 #define fp_prime_get_sps 	PREFIX(fp_prime_get_sps)
 #define fp_prime_get_qnr 	PREFIX(fp_prime_get_qnr)
 #define fp_prime_get_cnr 	PREFIX(fp_prime_get_cnr)
+#define fp_prime_get_chain 	PREFIX(fp_prime_get_chain)
 #define fp_param_get 	PREFIX(fp_param_get)
 #define fp_prime_set_dense 	PREFIX(fp_prime_set_dense)
 #define fp_prime_set_pmers 	PREFIX(fp_prime_set_pmers)
@@ -552,6 +639,8 @@
 #define fp_sub_basic 	PREFIX(fp_sub_basic)
 #define fp_sub_integ 	PREFIX(fp_sub_integ)
 #define fp_sub_dig 	PREFIX(fp_sub_dig)
+#define fp_addc 	PREFIX(fp_addc)
+#define fp_subc 	PREFIX(fp_subc)
 #define fp_neg_basic 	PREFIX(fp_neg_basic)
 #define fp_neg_integ 	PREFIX(fp_neg_integ)
 #define fp_dbl_basic 	PREFIX(fp_dbl_basic)
@@ -563,10 +652,15 @@
 #define fp_mul_integ 	PREFIX(fp_mul_integ)
 #define fp_mul_karat 	PREFIX(fp_mul_karat)
 #define fp_mul_dig 	PREFIX(fp_mul_dig)
+#define fp_mul_sim 	PREFIX(fp_mul_sim)
+#define fp_mul_unr 	PREFIX(fp_mul_unr)
+#define fp_mla_unr 	PREFIX(fp_mla_unr)
+#define fp_mls_unr 	PREFIX(fp_mls_unr)
 #define fp_sqr_basic 	PREFIX(fp_sqr_basic)
 #define fp_sqr_comba 	PREFIX(fp_sqr_comba)
 #define fp_sqr_integ 	PREFIX(fp_sqr_integ)
 #define fp_sqr_karat 	PREFIX(fp_sqr_karat)
+#define fp_sqr_unr 	PREFIX(fp_sqr_unr)
 #define fp_lsh 	PREFIX(fp_lsh)
 #define fp_rsh 	PREFIX(fp_rsh)
 #define fp_rdc_basic 	PREFIX(fp_rdc_basic)
@@ -582,6 +676,8 @@
 #define fp_exp_basic 	PREFIX(fp_exp_basic)
 #define fp_exp_slide 	PREFIX(fp_exp_slide)
 #define fp_exp_monty 	PREFIX(fp_exp_monty)
+#define fp_exp_gen 	PREFIX(fp_exp_gen)
+#define fp_exp_chain 	PREFIX(fp_exp_chain)
 #define fp_srt 	PREFIX(fp_srt)
 
 #undef fp_add1_low
@@ -611,6 +707,8 @@
 #undef fp_mul1_low
 #undef fp_muln_low
 #undef fp_mulm_low
+#undef fp_mulv_low
+#undef fp_lanes_low
 #undef fp_sqrn_low
 #undef fp_sqrm_low
 #undef fp_rdcs_low
@@ -644,6 +742,8 @@
 #define fp_mul1_low 	PREFIX(fp_mul1_low)
 #define fp_muln_low 	PREFIX(fp_muln_low)
 #define fp_mulm_low 	PREFIX(fp_mulm_low)
+#define fp_mulv_low 	PREFIX(fp_mulv_low)
+#define fp_lanes_low 	PREFIX(fp_lanes_low)
 #define fp_sqrn_low 	PREFIX(fp_sqrn_low)
 #define fp_sqrm_low 	PREFIX(fp_sqrm_low)
 #define fp_rdcs_low 	PREFIX(fp_rdcs_low)
@@ -940,6 +1040,7 @@
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_gen
+#undef ep_mul_sim_lot
 #undef ep_norm
 #undef ep_norm_sim
 #undef ep_map
@@ -1020,6 +1121,7 @@
 #define ep_mul_sim_inter 	PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_gen 	PREFIX(ep_mul_sim_gen)
+#define ep_mul_sim_lot 	PREFIX(ep_mul_sim_lot)
 #define ep_norm 	PREFIX(ep_norm)
 #define ep_norm_sim 	PREFIX(ep_norm_sim)
 #define ep_map 	PREFIX(ep_map)
@@ -1100,6 +1202,7 @@
 #undef eb_mul_sim_inter
 #undef eb_mul_sim_joint
 #undef eb_mul_sim_gen
+#undef eb_mul_sim_lot
 #undef eb_norm
 #undef eb_norm_sim
 #undef eb_map
@@ -1175,6 +1278,7 @@
 #define eb_mul_sim_inter 	PREFIX(eb_mul_sim_inter)
 #define eb_mul_sim_joint 	PREFIX(eb_mul_sim_joint)
 #define eb_mul_sim_gen 	PREFIX(eb_mul_sim_gen)
+#define eb_mul_sim_lot 	PREFIX(eb_mul_sim_lot)
 #define eb_norm 	PREFIX(eb_norm)
 #define eb_norm_sim 	PREFIX(eb_norm_sim)
 #define eb_map 	PREFIX(eb_map)
@@ -1217,7 +1321,11 @@
 #undef ep2_dbl_basic
 #undef ep2_dbl_slp_basic
 #undef ep2_dbl_projc
-#undef ep2_mul
+#undef ep2_mul_basic
+#undef ep2_mul_slide
+#undef ep2_mul_monty
+#undef ep2_mul_lwnaf
+#undef ep2_mul_lwreg
 #undef ep2_mul_gen
 #undef ep2_mul_pre_basic
 #undef ep2_mul_pre_yaowi
@@ -1236,8 +1344,10 @@
 #undef ep2_mul_sim_inter
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_gen
+#undef ep2_mul_sim_lot
 #undef ep2_mul_dig
 #undef ep2_norm
+#undef ep2_norm_sim
 #undef ep2_map
 #undef ep2_frb
 
@@ -1272,7 +1382,11 @@
 #define ep2_dbl_basic 	PREFIX(ep2_dbl_basic)
 #define ep2_dbl_slp_basic 	PREFIX(ep2_dbl_slp_basic)
 #define ep2_dbl_projc 	PREFIX(ep2_dbl_projc)
-#define ep2_mul 	PREFIX(ep2_mul)
+#define ep2_mul_basic 	PREFIX(ep2_mul_basic)
+#define ep2_mul_slide 	PREFIX(ep2_mul_slide)
+#define ep2_mul_monty 	PREFIX(ep2_mul_monty)
+#define ep2_mul_lwnaf 	PREFIX(ep2_mul_lwnaf)
+#define ep2_mul_lwreg 	PREFIX(ep2_mul_lwreg)
 #define ep2_mul_gen 	PREFIX(ep2_mul_gen)
 #define ep2_mul_pre_basic 	PREFIX(ep2_mul_pre_basic)
 #define ep2_mul_pre_yaowi 	PREFIX(ep2_mul_pre_yaowi)
@@ -1291,8 +1405,10 @@
 #define ep2_mul_sim_inter 	PREFIX(ep2_mul_sim_inter)
 #define ep2_mul_sim_joint 	PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_gen 	PREFIX(ep2_mul_sim_gen)
+#define ep2_mul_sim_lot 	PREFIX(ep2_mul_sim_lot)
 #define ep2_mul_dig 	PREFIX(ep2_mul_dig)
 #define ep2_norm 	PREFIX(ep2_norm)
+#define ep2_norm_sim 	PREFIX(ep2_norm_sim)
 #define ep2_map 	PREFIX(ep2_map)
 #define ep2_frb 	PREFIX(ep2_frb)
 
@@ -1729,6 +1845,13 @@
 #undef pp_map_tatep_k12
 #undef pp_map_weilp_k12
 #undef pp_map_oatep_k12
+#undef pp_map_sim_tatep_k2
+#undef pp_map_sim_weilp_k2
+#undef pp_map_sim_tatep_k12
+#undef pp_map_sim_weilp_k12
+#undef pp_map_sim_oatep_k12
+#undef pp_map_pre_k12
+#undef pp_map_fix_k12
 
 #define pp_map_init 	PREFIX(pp_map_init)
 #define pp_map_clean 	PREFIX(pp_map_clean)
@@ -1755,6 +1878,13 @@
 #define pp_map_tatep_k12 	PREFIX(pp_map_tatep_k12)
 #define pp_map_weilp_k12 	PREFIX(pp_map_weilp_k12)
 #define pp_map_oatep_k12 	PREFIX(pp_map_oatep_k12)
+#define pp_map_sim_tatep_k2 	PREFIX(pp_map_sim_tatep_k2)
+#define pp_map_sim_weilp_k2 	PREFIX(pp_map_sim_weilp_k2)
+#define pp_map_sim_tatep_k12 	PREFIX(pp_map_sim_tatep_k12)
+#define pp_map_sim_weilp_k12 	PREFIX(pp_map_sim_weilp_k12)
+#define pp_map_sim_oatep_k12 	PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_pre_k12 	PREFIX(pp_map_pre_k12)
+#define pp_map_fix_k12 	PREFIX(pp_map_fix_k12)
 
 #undef rsa_t
 #undef rabin_t
@@ -1772,6 +1902,8 @@
 #undef cp_rsa_dec_quick
 #undef cp_rsa_sig_basic
 #undef cp_rsa_sig_quick
+#undef cp_rsa_dec_batch
+#undef cp_rsa_sig_batch
 #undef cp_rsa_ver
 #undef cp_rabin_gen
 #undef cp_rabin_enc
@@ -1801,6 +1933,9 @@
 #undef cp_bls_gen
 #undef cp_bls_sig
 #undef cp_bls_ver
+#undef cp_bls_agg
+#undef cp_bls_ver_agg
+#undef cp_bls_ver_batch
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
@@ -1812,6 +1947,8 @@
 #define cp_rsa_dec_quick 	PREFIX(cp_rsa_dec_quick)
 #define cp_rsa_sig_basic 	PREFIX(cp_rsa_sig_basic)
 #define cp_rsa_sig_quick 	PREFIX(cp_rsa_sig_quick)
+#define cp_rsa_dec_batch 	PREFIX(cp_rsa_dec_batch)
+#define cp_rsa_sig_batch 	PREFIX(cp_rsa_sig_batch)
 #define cp_rsa_ver 	PREFIX(cp_rsa_ver)
 #define cp_rabin_gen 	PREFIX(cp_rabin_gen)
 #define cp_rabin_enc 	PREFIX(cp_rabin_enc)
@@ -1841,6 +1978,9 @@
 #define cp_bls_gen 	PREFIX(cp_bls_gen)
 #define cp_bls_sig 	PREFIX(cp_bls_sig)
 #define cp_bls_ver 	PREFIX(cp_bls_ver)
+#define cp_bls_agg 	PREFIX(cp_bls_agg)
+#define cp_bls_ver_agg 	PREFIX(cp_bls_ver_agg)
+#define cp_bls_ver_batch 	PREFIX(cp_bls_ver_batch)
 #define cp_bbs_gen 	PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	PREFIX(cp_bbs_ver)
@@ -761,6 +761,21 @@ typedef CAT(GT_LOWER, t) gt_t;
 #define pc_map(R, P, Q);	CAT(PC_LOWER, map_k2)(R, P, Q)
 #endif
 
+/**
+ * Computes the product of M bilinear pairings of G_1 and G_2 elements.
+ * Computes R = e(P_1, Q_1) * ... * e(P_M, Q_M).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the array of first elements.
+ * @param[in] Q				- the array of second elements.
+ * @param[in] M				- the number of pairings to evaluate.
+ */
+#if FP_PRIME < 1536
+#define pc_map_sim(R, P, Q, M)	CAT(PC_LOWER, map_sim_k12)(R, P, Q, M)
+#else
+#define pc_map_sim(R, P, Q, M)	CAT(PC_LOWER, map_sim_k2)(R, P, Q, M)
+#endif
+
 /**
  * Computes the final exponentiation of the pairing.
  *
@@ -48,17 +48,19 @@
 #if ALLOC == STATIC
 
 /**
- * The size of the static pool of digit vectors.
+ * The size of the static pool of digit vectors. When the pool is shared, this
+ * is the total number of digit vectors available to all threads.
  */
 #ifndef POOL_SIZE
 #define POOL_SIZE	(MAX(TESTS, MAX(BENCH * BENCH, 10000)))
 #endif
 
-/** Indicates that the pool element is already used. */
-#define POOL_USED	(1)
-
-/** Indicates that the pool element is free. */
-#define POOL_FREE	(0)
+/**
+ * The number of digit vectors cached by each thread when the pool is shared.
+ */
+#ifndef POOL_MAGAZ
+#define POOL_MAGAZ	(32)
+#endif
 
 /** Indicates that the pool is empty. */
 #define POOL_EMPTY (-1)
@@ -73,8 +75,6 @@
  * Type that represents a element of a pool of digit vectors.
  */
 typedef struct {
-	/** Indicates if this pool element is being used. */
-	int state;
 	/** The pool element. The extra digit stores the pool position. */
 	align dig_t elem[DV_DIGS + 1];
 } pool_t;
@@ -85,6 +85,17 @@ typedef struct {
 
 #if ALLOC == STATIC
 
+/**
+ * Initializes the static pool for the current library context.
+ */
+void pool_init(void);
+
+/**
+ * Returns the elements cached by the current library context to the static
+ * pool.
+ */
+void pool_clean(void);
+
 /**
  * Gets a new element from the static pool.
  *
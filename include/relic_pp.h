@@ -41,6 +41,16 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Size of a precomputation table of line functions for fixed-argument
+ * pairings.
+ */
+#define PP_TABLE			(FP_BITS / 2)
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -201,6 +211,42 @@
 #define pp_map_k12(R, P, Q)				pp_map_oatep_k12(R, P, Q)
 #endif
 
+/**
+ * Computes the product of m pairings of prime elliptic curve points defined on
+ * an elliptic curve of embedding degree 2. Computes e(P_1, Q_1) * ... *
+ * e(P_m, Q_m).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first elliptic curve points.
+ * @param[in] Q				- the second elliptic curve points.
+ * @param[in] M				- the number of pairings to evaluate.
+ */
+#if PP_MAP == TATEP
+#define pp_map_sim_k2(R, P, Q, M)		pp_map_sim_tatep_k2(R, P, Q, M)
+#elif PP_MAP == WEILP
+#define pp_map_sim_k2(R, P, Q, M)		pp_map_sim_weilp_k2(R, P, Q, M)
+#elif PP_MAP == OATEP
+#define pp_map_sim_k2(R, P, Q, M)		pp_map_sim_tatep_k2(R, P, Q, M)
+#endif
+
+/**
+ * Computes the product of m pairings of prime elliptic curve points defined on
+ * an elliptic curve of embedding degree 12. Computes e(P_1, Q_1) * ... *
+ * e(P_m, Q_m).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first elliptic curve points.
+ * @param[in] Q				- the second elliptic curve points.
+ * @param[in] M				- the number of pairings to evaluate.
+ */
+#if PP_MAP == TATEP
+#define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_tatep_k12(R, P, Q, M)
+#elif PP_MAP == WEILP
+#define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_weilp_k12(R, P, Q, M)
+#elif PP_MAP == OATEP
+#define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_oatep_k12(R, P, Q, M)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -467,4 +513,86 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q);
  */
 void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
 
+/**
+ * Computes the product of m Tate pairings of points in a parameterized
+ * elliptic curve with embedding degree 2, sharing the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve points.
+ * @param[in] q				- the second elliptic curve points.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_tatep_k2(fp2_t r, ep_t *p, ep_t *q, int m);
+
+/**
+ * Computes the product of m Weil pairings of points in a parameterized
+ * elliptic curve with embedding degree 2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve points.
+ * @param[in] q				- the second elliptic curve points.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_weilp_k2(fp2_t r, ep_t *p, ep_t *q, int m);
+
+/**
+ * Computes the product of m Tate pairings of points in a parameterized
+ * elliptic curve with embedding degree 12, sharing the squarings of the Miller
+ * loops and the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve points.
+ * @param[in] q				- the second elliptic curve points.
+ * @param[in] m				- the number of pairings to evaluate.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void pp_map_sim_tatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Computes the product of m Weil pairings of points in a parameterized
+ * elliptic curve with embedding degree 12.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve points.
+ * @param[in] q				- the second elliptic curve points.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_weilp_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Computes the product of m optimal ate pairings of points in a parameterized
+ * elliptic curve with embedding degree 12, sharing the squarings of the Miller
+ * loops and the final exponentiation.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve points.
+ * @param[in] q				- the second elliptic curve points.
+ * @param[in] m				- the number of pairings to evaluate.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Builds a precomputation table for computing optimal ate pairings with a
+ * fixed point in a parameterized elliptic curve with embedding degree 12.
+ * Each entry stores the coefficients of a line function, to be multiplied by
+ * the coordinates of the other point.
+ *
+ * @param[out] t			- the precomputation table of line functions.
+ * @param[in] q				- the fixed elliptic curve point.
+ * @throw ERR_NO_BUFFER		- if the table does not have enough room.
+ */
+void pp_map_pre_k12(fp6_t *t, ep2_t q);
+
+/**
+ * Computes the optimal ate pairing of two points in a parameterized elliptic
+ * curve with embedding degree 12, where the second point was fixed in a
+ * precomputation table.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] t				- the precomputation table for the second point.
+ */
+void pp_map_fix_k12(fp12_t r, ep_t p, fp6_t *t);
+
 #endif /* !RELIC_PP_H */
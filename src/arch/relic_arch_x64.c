@@ -30,17 +30,127 @@
  */
 
 #include "relic_types.h"
+#include "relic_arch.h"
+
+#if MULTI == PTHREAD
+#include <pthread.h>
+#endif
 
 /**
  * Renames the inline assembly macro to a prettier name.
  */
 #define asm					__asm__ volatile
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Instruction set extensions supported by the processor, or -1 if not yet
+ * detected.
+ */
+static int arch_cpu = -1;
+
+/**
+ * Instruction set extensions used by the arithmetic kernels.
+ */
+static int arch_ext = 0;
+
+#if MULTI == PTHREAD
+/**
+ * Guard running the detection only once among all threads.
+ */
+static pthread_once_t arch_once = PTHREAD_ONCE_INIT;
+#endif
+
+/**
+ * Queries the processor identification.
+ *
+ * @param[out] r			- the resulting EAX, EBX, ECX and EDX registers.
+ * @param[in] leaf			- the leaf to query.
+ * @param[in] sub			- the subleaf to query.
+ */
+static void arch_cpuid(unsigned int *r, unsigned int leaf, unsigned int sub) {
+	asm (
+		"cpuid"
+		: "=a" (r[0]), "=b" (r[1]), "=c" (r[2]), "=d" (r[3])
+		: "a" (leaf), "c" (sub)
+	);
+}
+
+/**
+ * Detects the instruction set extensions usable by the arithmetic kernels.
+ * Vector extensions are only reported if the operating system preserves the
+ * corresponding registers across context switches.
+ *
+ * @return the set of extensions, as a bitwise OR of ARCH_* flags.
+ */
+static int arch_detect(void) {
+	unsigned int r[4], max, lo, hi, xcr0 = 0;
+	int ext = 0;
+
+	arch_cpuid(r, 0, 0);
+	max = r[0];
+	if (max < 1) {
+		return 0;
+	}
+
+	arch_cpuid(r, 1, 0);
+	if (r[2] & (1u << 1)) {
+		ext |= ARCH_CLMUL;
+	}
+	/* Check if XGETBV is enabled by the operating system. */
+	if (r[2] & (1u << 27)) {
+		asm ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+		xcr0 = lo;
+	}
+
+	if (max >= 7) {
+		arch_cpuid(r, 7, 0);
+		if (r[1] & (1u << 8)) {
+			ext |= ARCH_BMI2;
+		}
+		if (r[1] & (1u << 19)) {
+			ext |= ARCH_ADX;
+		}
+		/* AVX2 needs the XMM and YMM states. */
+		if ((r[1] & (1u << 5)) && (xcr0 & 0x06) == 0x06) {
+			ext |= ARCH_AVX2;
+		}
+		/* IFMA needs AVX-512F and the opmask and ZMM states as well. */
+		if ((r[1] & (1u << 21)) && (r[1] & (1u << 16))
+				&& (xcr0 & 0xE6) == 0xE6) {
+			ext |= ARCH_IFMA;
+		}
+	}
+	return ext;
+}
+
+/**
+ * Detects the instruction set extensions and enables all of them.
+ */
+static void arch_start(void) {
+	arch_cpu = arch_detect();
+	arch_ext = arch_cpu;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void arch_init(void) {
+#if MULTI == PTHREAD
+	pthread_once(&arch_once, arch_start);
+#else
+#if MULTI == OPENMP
+#pragma omp critical (relic_arch)
+#endif
+	{
+		if (arch_cpu < 0) {
+			arch_start();
+		}
+	}
+#endif
 }
 
 void arch_clean(void) {
@@ -57,3 +167,12 @@ ull_t arch_cycles(void) {
 	);
 	return ((ull_t) lo) | (((ull_t) hi) << 32);
 }
+
+int arch_get_ext(void) {
+	return arch_ext;
+}
+
+void arch_set_ext(int ext) {
+	arch_init();
+	arch_ext = ext & arch_cpu;
+}
@@ -30,6 +30,148 @@
  */
 
 #include "relic_core.h"
+#include "relic_bn_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Computes c = -a for an integer stored in two's complement, if a flag is set.
+ *
+ * @param[in,out] a			- the digit vector.
+ * @param[in] digits		- the number of digits.
+ * @param[in] cond			- the flag, either 0 or 1.
+ */
+static void bn_gcd_neg_cond(dig_t *a, int digits, dig_t cond) {
+	dig_t mask = -cond, carry = cond;
+
+	for (int i = 0; i < digits; i++) {
+		a[i] = (a[i] ^ mask) + carry;
+		carry = (a[i] < carry);
+	}
+}
+
+/**
+ * Computes c = c + a for integers stored in two's complement, if a flag is
+ * set.
+ *
+ * @param[in,out] c			- the digit vector to accumulate.
+ * @param[in] a				- the digit vector to add.
+ * @param[in] digits		- the number of digits.
+ * @param[in] cond			- the flag, either 0 or 1.
+ * @return the carry.
+ */
+static dig_t bn_gcd_add_cond(dig_t *c, const dig_t *a, int digits,
+		dig_t cond) {
+	dig_t mask = -cond, carry = 0, t, r;
+
+	for (int i = 0; i < digits; i++) {
+		t = a[i] & mask;
+		r = c[i] + t;
+		t = (r < t);
+		c[i] = r + carry;
+		carry = t | (c[i] < r);
+	}
+	return carry;
+}
+
+/**
+ * Computes c = c - a for integers stored in two's complement, if a flag is
+ * set.
+ *
+ * @param[in,out] c			- the digit vector to accumulate.
+ * @param[in] a				- the digit vector to subtract.
+ * @param[in] digits		- the number of digits.
+ * @param[in] cond			- the flag, either 0 or 1.
+ * @return the borrow.
+ */
+static dig_t bn_gcd_sub_cond(dig_t *c, const dig_t *a, int digits,
+		dig_t cond) {
+	dig_t mask = -cond, borrow = 0, t, r;
+
+	for (int i = 0; i < digits; i++) {
+		t = a[i] & mask;
+		r = c[i] - t;
+		t = (r > c[i]);
+		c[i] = r - borrow;
+		borrow = t | (c[i] > r);
+	}
+	return borrow;
+}
+
+/**
+ * Computes (f, g) = (g, -f) for integers stored in two's complement, if a flag
+ * is set.
+ *
+ * @param[in,out] f			- the first digit vector.
+ * @param[in,out] g			- the second digit vector.
+ * @param[in] digits		- the number of digits.
+ * @param[in] cond			- the flag, either 0 or 1.
+ */
+static void bn_gcd_swp_neg(dig_t *f, dig_t *g, int digits, dig_t cond) {
+	dig_t mask = -cond, carry = cond, x, y;
+
+	for (int i = 0; i < digits; i++) {
+		x = f[i];
+		y = g[i];
+		f[i] = (y & mask) | (x & ~mask);
+		x = (x ^ mask) + carry;
+		carry = (x < carry);
+		g[i] = (x & mask) | (y & ~mask);
+	}
+}
+
+/**
+ * Computes (u, v) = (v, m - u) for integers in [0, m], if a flag is set.
+ *
+ * @param[in,out] u			- the first digit vector.
+ * @param[in,out] v			- the second digit vector.
+ * @param[in] m				- the modulus.
+ * @param[in] digits		- the number of digits.
+ * @param[in] cond			- the flag, either 0 or 1.
+ */
+static void bn_gcd_swp_sub(dig_t *u, dig_t *v, const dig_t *m, int digits,
+		dig_t cond) {
+	dig_t mask = -cond, borrow = 0, x, y, r, t;
+
+	for (int i = 0; i < digits; i++) {
+		x = u[i];
+		y = v[i];
+		u[i] = (y & mask) | (x & ~mask);
+		r = m[i] - x;
+		t = (r > m[i]);
+		x = r - borrow;
+		borrow = t | (x > r);
+		v[i] = (x & mask) | (y & ~mask);
+	}
+}
+
+/**
+ * Computes c = (c + a) / 2 for integers stored in two's complement, adding a
+ * only if a flag is set. The sum must be even and fit in the given digits.
+ *
+ * @param[in,out] c			- the digit vector to accumulate.
+ * @param[in] a				- the digit vector to add.
+ * @param[in] digits		- the number of digits.
+ * @param[in] cond			- the flag, either 0 or 1.
+ */
+static void bn_gcd_add_hlv(dig_t *c, const dig_t *a, int digits, dig_t cond) {
+	dig_t mask = -cond, carry = 0, t, r, prev = 0;
+
+	for (int i = 0; i < digits; i++) {
+		t = a[i] & mask;
+		r = c[i] + t;
+		t = (r < t);
+		r += carry;
+		carry = t | (r < carry);
+		if (i > 0) {
+			c[i - 1] = (prev >> 1) | (r << (BN_DIGIT - 1));
+		}
+		prev = r;
+	}
+	c[digits - 1] = (dig_t)((dis_t)prev >> 1);
+}
 
 /*============================================================================*/
 /* Public definitions                                                         */
@@ -1039,3 +1181,106 @@ void bn_gcd_ext_dig(bn_t c, bn_t d, bn_t e, const bn_t a, const dig_t b) {
 		bn_free(r);
 	}
 }
+
+void bn_mod_inv_const(bn_t c, const bn_t a, const bn_t m) {
+	bn_t f, g, u, v, p, t;
+	dig_t cond, odd;
+	int i, n, bits, iter, delta;
+
+	if (bn_is_zero(m) || bn_is_even(m) || bn_sign(m) == BN_NEG) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_null(f);
+	bn_null(g);
+	bn_null(u);
+	bn_null(v);
+	bn_null(p);
+	bn_null(t);
+
+	TRY {
+		n = m->used + 1;
+		bn_new_size(f, n);
+		bn_new_size(g, n);
+		bn_new_size(u, n);
+		bn_new_size(v, n);
+		bn_new_size(p, n);
+		bn_new_size(t, n);
+
+		dv_zero(p->dp, n);
+		dv_copy(p->dp, m->dp, m->used);
+
+		/* Reduce a bit by bit with masked subtractions, since it is secret. */
+		dv_zero(g->dp, n);
+		for (i = a->used * BN_DIGIT - 1; i >= 0; i--) {
+			bn_lsh1_low(g->dp, g->dp, n);
+			g->dp[0] |= (a->dp[i / BN_DIGIT] >> (i % BN_DIGIT)) & 1;
+			dv_copy(t->dp, g->dp, n);
+			odd = bn_gcd_sub_cond(t->dp, p->dp, n, 1);
+			dv_copy_cond(g->dp, t->dp, n, odd ^ 1);
+		}
+		/* Map a negative integer to m - (|a| mod m). */
+		dv_copy(t->dp, p->dp, n);
+		bn_gcd_sub_cond(t->dp, g->dp, n, 1);
+		dv_copy_cond(g->dp, t->dp, n, bn_sign(a) == BN_NEG);
+		dv_copy(f->dp, p->dp, n);
+		dv_zero(u->dp, n);
+		dv_zero(v->dp, n);
+		v->dp[0] = 1;
+
+		/*
+		 * Bernstein-Yang divsteps, keeping f = u * a and g = v * a modulo m.
+		 * The number of iterations only depends on the size of the modulus.
+		 */
+		bits = bn_bits(m);
+		iter = (bits < 46 ? (49 * bits + 80) / 17 : (49 * bits + 57) / 17);
+		delta = 1;
+		for (i = 0; i < iter; i++) {
+			/* If delta > 0 and g is odd, (f, g) = (g, -f). */
+			cond = (dig_t)(((unsigned int)-delta) >> (8 * sizeof(int) - 1));
+			cond &= g->dp[0] & 1;
+			delta = (delta ^ -(int)cond) + (int)cond;
+			bn_gcd_swp_neg(f->dp, g->dp, n, cond);
+			bn_gcd_swp_sub(u->dp, v->dp, p->dp, n, cond);
+			delta++;
+			/* If g is odd, g = g + f. Then g = g / 2 and v = v / 2 mod m. */
+			odd = g->dp[0] & 1;
+			bn_gcd_add_hlv(g->dp, f->dp, n, odd);
+			bn_gcd_add_cond(v->dp, u->dp, n, odd);
+			dv_copy(t->dp, v->dp, n);
+			odd = bn_gcd_sub_cond(t->dp, p->dp, n, 1);
+			dv_copy_cond(v->dp, t->dp, n, odd ^ 1);
+			bn_gcd_add_hlv(v->dp, p->dp, n, v->dp[0] & 1);
+		}
+
+		/* Now f = +-gcd(a, m) and the inverse is +-u. */
+		cond = f->dp[n - 1] >> (BN_DIGIT - 1);
+		bn_gcd_neg_cond(f->dp, n, cond);
+		dv_copy(t->dp, p->dp, n);
+		bn_gcd_sub_cond(t->dp, u->dp, n, 1);
+		dv_copy_cond(u->dp, t->dp, n, cond);
+
+		f->used = n;
+		f->sign = BN_POS;
+		bn_trim(f);
+		if (bn_cmp_dig(f, 1) != CMP_EQ) {
+			THROW(ERR_NO_VALID);
+		}
+		u->used = n;
+		u->sign = BN_POS;
+		bn_trim(u);
+		bn_copy(c, u);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(f);
+		bn_free(g);
+		bn_free(u);
+		bn_free(v);
+		bn_free(p);
+		bn_free(t);
+	}
+}
@@ -69,6 +69,18 @@ void bn_init(bn_t a, int digits) {
 		free(a);
 		THROW(ERR_NO_MEMORY);
 	}
+#elif ALLOC == ARENA
+	if (digits % BN_SIZE != 0) {
+		/* Pad the number of digits to a multiple of the block. */
+		digits += (BN_SIZE - digits % BN_SIZE);
+	}
+
+	if (a != NULL) {
+		a->dp = (dig_t *)arena_get(digits * sizeof(dig_t));
+		if (a->dp == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+	}
 #else
 	/* Verify if the number of digits is sane. */
 	if (digits > BN_SIZE) {
@@ -106,6 +118,15 @@ void bn_clean(bn_t a) {
 		a->alloc = 0;
 	}
 #endif
+#if ALLOC == ARENA
+	if (a != NULL) {
+		if (a->dp != NULL) {
+			arena_put(a->dp);
+			a->dp = NULL;
+		}
+		a->alloc = 0;
+	}
+#endif
 #if ALLOC == STATIC
 	if (a != NULL && a->dp != NULL) {
 		pool_put(a->dp);
@@ -133,6 +154,19 @@ void bn_grow(bn_t a, int digits) {
 		/* Set the newly allocated digits to zero. */
 		a->alloc = digits;
 	}
+#elif ALLOC == ARENA
+	dig_t *t;
+
+	if (a->alloc < digits) {
+		/* At least add BN_SIZE more digits. */
+		digits += (BN_SIZE * 2) - (digits % BN_SIZE);
+		t = (dig_t *)arena_grow(a->dp, (BN_DIGIT / 8) * digits);
+		if (t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		a->dp = t;
+		a->alloc = digits;
+	}
 #else /* ALLOC == STATIC || ALLOC == STACK */
 	if (digits > BN_SIZE) {
 		THROW(ERR_NO_PRECI)
@@ -150,8 +150,6 @@ void bn_mod_barrt(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 
 #endif /* BN_MOD == BARRT || !defined(STRIP) */
 
-#if BN_MOD == MONTY || (defined(WITH_FP) && FP_RDC == MONTY) || !defined(STRIP)
-
 void bn_mod_pre_monty(bn_t u, const bn_t m) {
 	dig_t x, b;
 	b = m->dp[0];
@@ -246,7 +244,7 @@ void bn_mod_monty_basic(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 
 #endif /* BN_MUL == BASIC || !defined(STRIP) */
 
-#if BN_MUL == COMBA || !defined(STRIP)
+#if BN_MUL == COMBA || BN_MUL == ADAPT || !defined(STRIP)
 
 void bn_mod_monty_comba(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 	int digits;
@@ -276,9 +274,43 @@ void bn_mod_monty_comba(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 	}
 }
 
-#endif /* BN_MUL == COMBA || !defined(STRIP) */
+#endif /* BN_MUL == COMBA || BN_MUL == ADAPT || !defined(STRIP) */
+
+void bn_mont_set(bn_mont_t ctx, const bn_t m) {
+	bn_mod_pre_monty(ctx->u, m);
+	bn_copy(ctx->m, m);
+	bn_set_2b(ctx->one, m->used * BN_DIGIT);
+	bn_mod_basic(ctx->one, ctx->one, m);
+	bn_sqr(ctx->r2, ctx->one);
+	bn_mod_basic(ctx->r2, ctx->r2, m);
+}
 
-#endif /* BN_MOD == MONTY || (WITH_FP && FP_RDC == MONTY) || !defined(STRIP) */
+void bn_mont_conv(bn_t c, const bn_t a, const bn_mont_t ctx) {
+	if (bn_sign(a) == BN_NEG || bn_cmp(a, ctx->m) != CMP_LT) {
+		bn_mod_basic(c, a, ctx->m);
+		if (bn_sign(c) == BN_NEG) {
+			bn_add(c, c, ctx->m);
+		}
+		bn_mul(c, c, ctx->r2);
+	} else {
+		bn_mul(c, a, ctx->r2);
+	}
+	bn_mod_monty(c, c, ctx->m, ctx->u);
+}
+
+void bn_mont_back(bn_t c, const bn_t a, const bn_mont_t ctx) {
+	bn_mod_monty(c, a, ctx->m, ctx->u);
+}
+
+void bn_mont_mul(bn_t c, const bn_t a, const bn_t b, const bn_mont_t ctx) {
+	bn_mul(c, a, b);
+	bn_mod_monty(c, c, ctx->m, ctx->u);
+}
+
+void bn_mont_sqr(bn_t c, const bn_t a, const bn_mont_t ctx) {
+	bn_sqr(c, a);
+	bn_mod_monty(c, c, ctx->m, ctx->u);
+}
 
 #if BN_MOD == PMERS || !defined(STRIP)
 
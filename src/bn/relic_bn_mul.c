@@ -108,7 +108,7 @@ static void bn_mul_karat_imp(bn_t c, const bn_t a, const bn_t b, int level) {
 #if BN_MUL == BASIC
 			bn_mul_basic(a0b0, a0, b0);
 			bn_mul_basic(a1b1, a1, b1);
-#elif BN_MUL == COMBA
+#elif BN_MUL == COMBA || BN_MUL == ADAPT
 			bn_mul_comba(a0b0, a0, b0);
 			bn_mul_comba(a1b1, a1, b1);
 #endif
@@ -126,7 +126,7 @@ static void bn_mul_karat_imp(bn_t c, const bn_t a, const bn_t b, int level) {
 		if (level <= 1) {
 #if BN_MUL == BASIC
 			bn_mul_basic(t, a1, b1);
-#elif BN_MUL == COMBA
+#elif BN_MUL == COMBA || BN_MUL == ADAPT
 			bn_mul_comba(t, a1, b1);
 #endif
 		} else {
@@ -170,6 +170,212 @@ static void bn_mul_karat_imp(bn_t c, const bn_t a, const bn_t b, int level) {
 
 #endif
 
+#if BN_MUL == ADAPT || BN_SQR == ADAPT || !defined(STRIP)
+
+/**
+ * Number of primes used by the number-theoretic transform.
+ */
+#define NTT_PRIMES		3
+
+/**
+ * Maximum length of a transform, enough for the product of any two integers
+ * that fit in a multiple precision integer.
+ */
+#define NTT_SIZE		(4 * CEIL(BN_SIZE * BN_DIGIT, 32))
+
+/**
+ * Primes of the form c * 2^k + 1 used by the transform, with k >= 24.
+ */
+static const uint32_t ntt_prime[NTT_PRIMES] = {
+	2013265921, 469762049, 754974721
+};
+
+/**
+ * Generators of the multiplicative groups modulo each prime.
+ */
+static const uint32_t ntt_gen[NTT_PRIMES] = { 31, 3, 11 };
+
+/**
+ * Multiplies two residues in Montgomery form modulo a prime below 2^31.
+ *
+ * @param[in] a				- the first residue.
+ * @param[in] b				- the second residue.
+ * @param[in] p				- the prime modulus.
+ * @param[in] u				- the value -p^(-1) mod 2^32.
+ * @return a * b * 2^(-32) mod p.
+ */
+static uint32_t ntt_mul(uint32_t a, uint32_t b, uint32_t p, uint32_t u) {
+	uint64_t t = (uint64_t)a * b;
+	uint32_t m = (uint32_t)t * u;
+
+	t = (t + (uint64_t)m * p) >> 32;
+	return (uint32_t)(t >= p ? t - p : t);
+}
+
+/**
+ * Exponentiates a residue in Montgomery form.
+ *
+ * @param[in] a				- the basis.
+ * @param[in] e				- the exponent.
+ * @param[in] one			- the representation of one.
+ * @param[in] p				- the prime modulus.
+ * @param[in] u				- the value -p^(-1) mod 2^32.
+ * @return a^e mod p in Montgomery form.
+ */
+static uint32_t ntt_exp(uint32_t a, uint32_t e, uint32_t one, uint32_t p,
+		uint32_t u) {
+	uint32_t r = one;
+
+	while (e > 0) {
+		if (e & 1) {
+			r = ntt_mul(r, a, p, u);
+		}
+		a = ntt_mul(a, a, p, u);
+		e >>= 1;
+	}
+	return r;
+}
+
+/**
+ * Computes a number-theoretic transform in place.
+ *
+ * @param[in,out] f			- the vector to transform.
+ * @param[in] n				- the length of the vector, a power of 2.
+ * @param[in] w				- a primitive n-th root of unity in Montgomery form.
+ * @param[in] one			- the representation of one.
+ * @param[in] p				- the prime modulus.
+ * @param[in] u				- the value -p^(-1) mod 2^32.
+ */
+static void ntt_imp(uint32_t *f, int n, uint32_t w, uint32_t one, uint32_t p,
+		uint32_t u) {
+	int i, j, k, l;
+	uint32_t s, t, x, y;
+
+	/* Permute the vector in bit-reversed order. */
+	for (i = 1, j = 0; i < n; i++) {
+		for (k = n >> 1; j & k; k >>= 1) {
+			j ^= k;
+		}
+		j ^= k;
+		if (i < j) {
+			t = f[i];
+			f[i] = f[j];
+			f[j] = t;
+		}
+	}
+
+	for (l = 2; l <= n; l <<= 1) {
+		s = ntt_exp(w, n / l, one, p, u);
+		for (i = 0; i < n; i += l) {
+			t = one;
+			for (j = 0; j < l / 2; j++) {
+				x = f[i + j];
+				y = ntt_mul(f[i + j + l / 2], t, p, u);
+				f[i + j] = (x + y >= p ? x + y - p : x + y);
+				f[i + j + l / 2] = (x >= y ? x - y : x + p - y);
+				t = ntt_mul(t, s, p, u);
+			}
+		}
+	}
+}
+
+/**
+ * Splits the absolute value of a multiple precision integer into 32-bit
+ * chunks, least significant first.
+ *
+ * @param[out] f			- the chunks.
+ * @param[in] a				- the multiple precision integer.
+ * @return the number of chunks.
+ */
+static int ntt_split(uint32_t *f, const bn_t a) {
+	int i, len = bn_size_bin(a);
+	uint8_t bin[BN_SIZE * sizeof(dig_t)];
+
+	bn_write_bin(bin, len, a);
+	for (i = 0; i < CEIL(len, 4); i++) {
+		f[i] = 0;
+	}
+	for (i = 0; i < len; i++) {
+		f[i / 4] |= (uint32_t)bin[len - 1 - i] << (8 * (i % 4));
+	}
+	return CEIL(len, 4);
+}
+
+/**
+ * Splits the absolute value of a multiple precision integer into pieces of
+ * a given number of digits.
+ *
+ * @param[out] t			- the pieces, least significant first.
+ * @param[in] m				- the number of pieces.
+ * @param[in] a				- the multiple precision integer.
+ * @param[in] k				- the number of digits in each piece.
+ */
+static void bn_mul_split(bn_t *t, int m, const bn_t a, int k) {
+	int i, l;
+
+	for (i = 0; i < m; i++) {
+		l = MIN(k, a->used - i * k);
+		bn_zero(t[i]);
+		if (l > 0) {
+			bn_grow(t[i], l);
+			dv_copy(t[i]->dp, a->dp + i * k, l);
+			t[i]->used = l;
+			bn_trim(t[i]);
+		}
+	}
+}
+
+/**
+ * Recombines the coefficients of a product evaluated at 2^(k * BN_DIGIT).
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the coefficients, least significant first.
+ * @param[in] m				- the number of coefficients.
+ * @param[in] k				- the number of digits in each piece.
+ */
+static void bn_mul_join(bn_t c, bn_t *t, int m, int k) {
+	bn_copy(c, t[m - 1]);
+	for (int i = m - 2; i >= 0; i--) {
+		bn_lsh(c, c, k * BN_DIGIT);
+		bn_add(c, c, t[i]);
+	}
+}
+
+/**
+ * Multiplies or squares the pieces of a Toom-Cook evaluation.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first multiple precision integer.
+ * @param[in] b				- the second multiple precision integer.
+ */
+static void bn_mul_part(bn_t c, const bn_t a, const bn_t b) {
+	if (a == b) {
+		bn_sqr_adapt(c, a);
+	} else {
+		bn_mul_adapt(c, a, b);
+	}
+}
+
+/**
+ * Evaluates the pieces of a multiple precision integer at the points 0, 1, -1,
+ * -2 and infinity for Toom-3 multiplication.
+ *
+ * @param[out] e			- the evaluations.
+ * @param[in] a				- the three pieces.
+ */
+static void bn_mul_toom3_eval(bn_t *e, bn_t *a) {
+	bn_copy(e[0], a[0]);
+	bn_add(e[3], a[0], a[2]);
+	bn_add(e[1], e[3], a[1]);
+	bn_sub(e[2], e[3], a[1]);
+	bn_add(e[3], e[2], a[2]);
+	bn_dbl(e[3], e[3]);
+	bn_sub(e[3], e[3], a[0]);
+	bn_copy(e[4], a[2]);
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -223,7 +429,7 @@ void bn_mul_basic(bn_t c, const bn_t a, const bn_t b) {
 
 #endif
 
-#if BN_MUL == COMBA || !defined(STRIP)
+#if BN_MUL == COMBA || BN_MUL == ADAPT || !defined(STRIP)
 
 void bn_mul_comba(bn_t c, const bn_t a, const bn_t b) {
 	int digits;
@@ -271,3 +477,218 @@ void bn_mul_karat(bn_t c, const bn_t a, const bn_t b) {
 }
 
 #endif
+
+#if BN_MUL == ADAPT || BN_SQR == ADAPT || !defined(STRIP)
+
+void bn_mul_toom3(bn_t c, const bn_t a, const bn_t b) {
+	int i, k, sign = a->sign ^ b->sign;
+	bn_t u[3], v[3], x[5], y[5], r[5];
+
+	if (bn_is_zero(a) || bn_is_zero(b)) {
+		bn_zero(c);
+		return;
+	}
+
+	for (i = 0; i < 5; i++) {
+		if (i < 3) {
+			bn_null(u[i]);
+			bn_null(v[i]);
+		}
+		bn_null(x[i]);
+		bn_null(y[i]);
+		bn_null(r[i]);
+	}
+
+	TRY {
+		for (i = 0; i < 5; i++) {
+			if (i < 3) {
+				bn_new(u[i]);
+				bn_new(v[i]);
+			}
+			bn_new(x[i]);
+			bn_new(y[i]);
+			bn_new(r[i]);
+		}
+
+		k = CEIL(MAX(a->used, b->used), 3);
+		bn_mul_split(u, 3, a, k);
+		bn_mul_toom3_eval(x, u);
+		if (a != b) {
+			bn_mul_split(v, 3, b, k);
+			bn_mul_toom3_eval(y, v);
+		}
+		for (i = 0; i < 5; i++) {
+			bn_mul_part(r[i], x[i], (a == b ? x[i] : y[i]));
+		}
+
+		/* Interpolate from r(0), r(1), r(-1), r(-2) and r(inf). */
+		/* O = c1 + c3, c2 = (r(1) + r(-1)) / 2 - c0 - c4. */
+		bn_sub(x[1], r[1], r[2]);
+		bn_hlv(x[1], x[1]);
+		bn_add(x[2], r[1], r[2]);
+		bn_hlv(x[2], x[2]);
+		bn_sub(x[2], x[2], r[0]);
+		bn_sub(x[2], x[2], r[4]);
+		/* T = (r(-2) - c0 - 4 * c2 - 16 * c4) / (-2) = c1 + 4 * c3. */
+		bn_sub(x[3], r[3], r[0]);
+		bn_lsh(x[4], x[2], 2);
+		bn_sub(x[3], x[3], x[4]);
+		bn_lsh(x[4], r[4], 4);
+		bn_sub(x[3], x[3], x[4]);
+		bn_hlv(x[3], x[3]);
+		bn_neg(x[3], x[3]);
+		bn_sub(x[3], x[3], x[1]);
+		/* c3 = (T - O) / 3, c1 = O - c3. */
+		bn_div_dig(x[3], x[3], 3);
+		bn_sub(x[1], x[1], x[3]);
+		bn_copy(x[0], r[0]);
+		bn_copy(x[4], r[4]);
+
+		bn_mul_join(c, x, 5, k);
+		c->sign = sign;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < 5; i++) {
+			if (i < 3) {
+				bn_free(u[i]);
+				bn_free(v[i]);
+			}
+			bn_free(x[i]);
+			bn_free(y[i]);
+			bn_free(r[i]);
+		}
+	}
+}
+
+void bn_mul_ntt(bn_t c, const bn_t a, const bn_t b) {
+	int i, j, l, la, lb, n, sign = a->sign ^ b->sign;
+	uint32_t p, u, one, r2, w, z, *f;
+	uint64_t s, t, v, d0, d1, m0, m1, i01, i012, p01;
+	uint32_t fb[NTT_SIZE], res[NTT_PRIMES][NTT_SIZE];
+	uint32_t acc[NTT_SIZE + 4];
+	uint8_t bin[4 * (NTT_SIZE + 4)];
+
+	if (bn_is_zero(a) || bn_is_zero(b)) {
+		bn_zero(c);
+		return;
+	}
+
+	la = CEIL(bn_size_bin(a), 4);
+	lb = CEIL(bn_size_bin(b), 4);
+	for (n = 1; n < la + lb - 1; n <<= 1);
+	if (n > NTT_SIZE) {
+		THROW(ERR_NO_PRECI);
+		return;
+	}
+
+	for (j = 0; j < NTT_PRIMES; j++) {
+		p = ntt_prime[j];
+		/* Compute u = -p^(-1) mod 2^32 by Newton iteration. */
+		u = p;
+		for (i = 0; i < 4; i++) {
+			u *= 2 - p * u;
+		}
+		u = -u;
+		one = (uint32_t)(((uint64_t)1 << 32) % p);
+		r2 = (uint32_t)(((uint64_t)one * one) % p);
+		w = ntt_mul(ntt_gen[j], r2, p, u);
+		w = ntt_exp(w, (p - 1) / n, one, p, u);
+
+		for (l = 0; l < 2; l++) {
+			if (l == 1 && a == b) {
+				break;
+			}
+			f = (l == 0 ? res[j] : fb);
+			if (l == 0) {
+				ntt_split(f, a);
+			} else {
+				ntt_split(f, b);
+			}
+			for (i = 0; i < (l == 0 ? la : lb); i++) {
+				f[i] = ntt_mul(f[i] % p, r2, p, u);
+			}
+			for (; i < n; i++) {
+				f[i] = 0;
+			}
+			ntt_imp(f, n, w, one, p, u);
+		}
+		f = (a == b ? res[j] : fb);
+		for (i = 0; i < n; i++) {
+			res[j][i] = ntt_mul(res[j][i], f[i], p, u);
+		}
+		/* Invert the transform using w^(-1) and scaling by n^(-1). */
+		ntt_imp(res[j], n, ntt_exp(w, n - 1, one, p, u), one, p, u);
+		z = ntt_exp(ntt_mul(n, r2, p, u), p - 2, one, p, u);
+		for (i = 0; i < n; i++) {
+			res[j][i] = ntt_mul(ntt_mul(res[j][i], z, p, u), 1, p, u);
+		}
+	}
+
+	/* Reconstruct each coefficient with Garner's algorithm. */
+	m0 = ntt_prime[0];
+	m1 = ntt_prime[1];
+	p = ntt_prime[2];
+	p01 = m0 * m1;
+	i01 = 1;
+	for (t = m0 % m1, v = m1 - 2; v > 0; v >>= 1, t = (t * t) % m1) {
+		if (v & 1) {
+			i01 = (i01 * t) % m1;
+		}
+	}
+	i012 = 1;
+	for (t = p01 % p, v = p - 2; v > 0; v >>= 1, t = (t * t) % p) {
+		if (v & 1) {
+			i012 = (i012 * t) % p;
+		}
+	}
+	for (i = 0; i < la + lb + 4; i++) {
+		acc[i] = 0;
+	}
+	for (i = 0; i < la + lb - 1; i++) {
+		t = ((res[1][i] + m1 - res[0][i] % m1) % m1) * i01 % m1;
+		v = res[0][i] + m0 * t;
+		t = ((res[2][i] + p - v % p) % p) * i012 % p;
+		/* Add v + p01 * t, a 96-bit value, to the accumulator. */
+		s = (p01 & 0xFFFFFFFF) * t;
+		t = (p01 >> 32) * t;
+		d0 = (v & 0xFFFFFFFF) + (s & 0xFFFFFFFF);
+		d1 = (v >> 32) + (s >> 32) + (t & 0xFFFFFFFF) + (d0 >> 32);
+		t = (t >> 32) + (d1 >> 32);
+		s = (uint64_t)acc[i] + (d0 & 0xFFFFFFFF);
+		acc[i] = (uint32_t)s;
+		s = (uint64_t)acc[i + 1] + (d1 & 0xFFFFFFFF) + (s >> 32);
+		acc[i + 1] = (uint32_t)s;
+		s = (uint64_t)acc[i + 2] + t + (s >> 32);
+		acc[i + 2] = (uint32_t)s;
+		for (l = i + 3; (s >> 32) != 0; l++) {
+			s = (uint64_t)acc[l] + (s >> 32);
+			acc[l] = (uint32_t)s;
+		}
+	}
+
+	l = 4 * (la + lb);
+	for (i = 0; i < l; i++) {
+		bin[l - 1 - i] = (uint8_t)(acc[i / 4] >> (8 * (i % 4)));
+	}
+	bn_read_bin(c, bin, l);
+	c->sign = sign;
+}
+
+void bn_mul_adapt(bn_t c, const bn_t a, const bn_t b) {
+	int n = MIN(a->used, b->used);
+
+	if (n >= MAX(BN_TOOM3, 3)) {
+		bn_mul_toom3(c, a, b);
+	} else {
+#if BN_KARAT > 0
+		bn_mul_karat(c, a, b);
+#else
+		bn_mul_comba(c, a, b);
+#endif
+	}
+}
+
+#endif
@@ -29,7 +29,11 @@
  * @ingroup bn
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "relic_core.h"
+#include "relic_bn_low.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -40,6 +44,210 @@
  */
 #define TABLE_SIZE			64
 
+/**
+ * Chooses the width of the sliding window for an exponent.
+ *
+ * @param[in] bits			- the length of the exponent in bits.
+ * @return the window width.
+ */
+static int bn_mxp_width(int bits) {
+	if (bits <= 21) {
+		return 2;
+	} else if (bits <= 32) {
+		return 3;
+	} else if (bits <= 128) {
+		return 4;
+	} else if (bits <= 256) {
+		return 5;
+	}
+	return 6;
+}
+
+/**
+ * Width of the largest fixed window used by constant-time exponentiation.
+ */
+#define CONST_WIDTH			5
+
+/**
+ * Chooses the width of the fixed window for a constant-time exponentiation.
+ *
+ * @param[in] bits			- the length of the exponent in bits.
+ * @return the window width.
+ */
+static int bn_mxp_fixed(int bits) {
+	if (bits <= 32) {
+		return 2;
+	} else if (bits <= 128) {
+		return 3;
+	} else if (bits <= 512) {
+		return 4;
+	}
+	return CONST_WIDTH;
+}
+
+/**
+ * Stores a digit vector in a table of n entries, interleaving the digits of all
+ * entries so that the i-th digit of the k-th entry is at position i * n + k.
+ *
+ * @param[out] tab			- the table.
+ * @param[in] a				- the digit vector to store.
+ * @param[in] k				- the index of the entry.
+ * @param[in] n				- the number of entries.
+ * @param[in] digs			- the number of digits of each entry.
+ */
+static void bn_mxp_scatter(dig_t *tab, const dig_t *a, int k, int n, int digs) {
+	for (int i = 0; i < digs; i++) {
+		tab[i * n + k] = a[i];
+	}
+}
+
+/**
+ * Reads an entry from a table built by bn_mxp_scatter(). Every digit of every
+ * entry is read, so the memory access pattern does not depend on the index.
+ *
+ * @param[out] a			- the entry read.
+ * @param[in] tab			- the table.
+ * @param[in] k				- the index of the entry.
+ * @param[in] n				- the number of entries.
+ * @param[in] digs			- the number of digits of each entry.
+ */
+static void bn_mxp_gather(dig_t *a, const dig_t *tab, int k, int n, int digs) {
+	dig_t d, mask[1 << CONST_WIDTH], t;
+
+	for (int j = 0; j < n; j++) {
+		d = (dig_t)(j ^ k);
+		mask[j] = ((d | -d) >> (BN_DIGIT - 1)) - 1;
+	}
+
+	for (int i = 0; i < digs; i++) {
+		t = 0;
+		for (int j = 0; j < n; j++) {
+			t |= tab[i * n + j] & mask[j];
+		}
+		a[i] = t;
+	}
+}
+
+/**
+ * Reduces a double precision digit vector modulo an odd modulus using
+ * Montgomery reduction. The final subtraction is masked, so the running time
+ * does not depend on the value reduced.
+ *
+ * @param[out] c			- the result, with n digits.
+ * @param[in,out] t			- the digit vector to reduce, with 2 * n digits.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery reduction constant.
+ * @param[in] n				- the number of digits of the modulus.
+ */
+static void bn_mxp_rdc(dig_t *c, dig_t *t, const dig_t *m, dig_t u, int n) {
+	dig_t r, carry, top = 0, s;
+
+	for (int i = 0; i < n; i++) {
+		r = (dig_t)(t[i] * u);
+		carry = bn_mul1_low(c, m, r, n);
+		carry += bn_addn_low(t + i, t + i, c, n);
+		s = t[i + n] + carry;
+		carry = (s < carry);
+		t[i + n] = s + top;
+		top = carry | (t[i + n] < top);
+	}
+	/* The result is smaller than 2m, so one masked subtraction is enough. */
+	carry = bn_subn_low(c, t + n, m, n);
+	dv_copy_cond(c, t + n, n, carry & (top ^ 1));
+}
+
+/**
+ * Multiplies two digit vectors in Montgomery form in constant time.
+ *
+ * @param[out] c			- the result, with n digits.
+ * @param[in] a				- the first digit vector to multiply.
+ * @param[in] b				- the second digit vector to multiply.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery reduction constant.
+ * @param[in] n				- the number of digits of the modulus.
+ * @param[in] t				- a temporary vector with 2 * n digits.
+ */
+static void bn_mxp_mul(dig_t *c, const dig_t *a, const dig_t *b,
+		const dig_t *m, dig_t u, int n, dig_t *t) {
+	bn_muln_low(t, a, b, n);
+	bn_mxp_rdc(c, t, m, u, n);
+}
+
+/**
+ * Squares a digit vector in Montgomery form in constant time.
+ *
+ * @param[out] c			- the result, with n digits.
+ * @param[in] a				- the digit vector to square.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery reduction constant.
+ * @param[in] n				- the number of digits of the modulus.
+ * @param[in] t				- a temporary vector with 2 * n digits.
+ */
+static void bn_mxp_sqr(dig_t *c, const dig_t *a, const dig_t *m, dig_t u,
+		int n, dig_t *t) {
+	bn_sqrn_low(t, a, n);
+	bn_mxp_rdc(c, t, m, u, n);
+}
+
+/**
+ * Reduces an integer modulo a modulus bit by bit with masked subtractions, so
+ * that the running time only depends on the length of the integer.
+ *
+ * @param[out] c			- the result, with room for n + 1 digits.
+ * @param[in] a				- the integer to reduce.
+ * @param[in] m				- the modulus.
+ * @param[in] n				- the number of digits of the modulus.
+ * @param[in] t				- a temporary vector with n + 1 digits.
+ */
+static void bn_mxp_red(dig_t *c, const bn_t a, const dig_t *m, int n,
+		dig_t *t) {
+	dig_t borrow;
+
+	dv_zero(c, n + 1);
+	for (int i = a->used * BN_DIGIT - 1; i >= 0; i--) {
+		bn_lsh1_low(c, c, n + 1);
+		c[0] |= (a->dp[i / BN_DIGIT] >> (i % BN_DIGIT)) & 1;
+		borrow = bn_subn_low(t, c, m, n);
+		t[n] = c[n] - borrow;
+		borrow = (c[n] < borrow);
+		dv_copy_cond(c, t, n + 1, borrow ^ 1);
+	}
+	/* Map a negative integer to m - (|a| mod m). */
+	bn_subn_low(t, m, c, n);
+	dv_copy_cond(c, t, n, bn_sign(a) == BN_NEG);
+}
+
+/**
+ * Recodes an exponent in odd windows of at most w bits, storing each window
+ * at the position of its least significant bit and zero elsewhere.
+ *
+ * @param[out] win			- the recoded exponent.
+ * @param[in] len			- the number of positions to recode.
+ * @param[in] b				- the exponent.
+ * @param[in] w				- the window width.
+ */
+static void bn_mxp_rec(uint8_t *win, int len, const bn_t b, int w) {
+	int i, j, k;
+
+	memset(win, 0, len);
+	i = len - 1;
+	while (i >= 0) {
+		if (!bn_get_bit(b, i)) {
+			i--;
+			continue;
+		}
+		j = MAX(i - w + 1, 0);
+		while (!bn_get_bit(b, j)) {
+			j++;
+		}
+		win[j] = 0;
+		for (k = i; k >= j; k--) {
+			win[j] = (win[j] << 1) | bn_get_bit(b, k);
+		}
+		i = j - 1;
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -121,18 +329,7 @@ void bn_mxp_slide(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 	TRY {
 
 		/* Find window size. */
-		i = bn_bits(b);
-		if (i <= 21) {
-			w = 2;
-		} else if (i <= 32) {
-			w = 3;
-		} else if (i <= 128) {
-			w = 4;
-		} else if (i <= 256) {
-			w = 5;
-		} else {
-			w = 6;
-		}
+		w = bn_mxp_width(bn_bits(b));
 
 		for (i = 1; i < (1 << w); i += 2) {
 			bn_new(tab[i]);
@@ -262,6 +459,174 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 
 #endif
 
+void bn_mxp_consttime(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
+	bn_mont_t ctx;
+
+	bn_mont_null(ctx);
+
+	TRY {
+		bn_mont_new(ctx);
+		bn_mont_set(ctx, m);
+		bn_mont_mxp_consttime(c, a, b, ctx);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_mont_free(ctx);
+	}
+}
+
+void bn_mont_mxp_consttime(bn_t c, const bn_t a, const bn_t b,
+		const bn_mont_t ctx) {
+	dig_t tab[(1 << CONST_WIDTH) * BN_DIGS], u;
+	bn_t t, x, r, s;
+	const dig_t *m;
+	int i, j, k, l, n, w, digs;
+
+	digs = ctx->m->used;
+	if (digs > BN_DIGS) {
+		THROW(ERR_NO_PRECI);
+		return;
+	}
+	m = ctx->m->dp;
+	u = ctx->u->dp[0];
+
+	/* Process as many windows as the modulus needs, hiding short exponents. */
+	l = MAX(bn_bits(b), bn_bits(ctx->m));
+	w = bn_mxp_fixed(l);
+	n = 1 << w;
+	l = (l + w - 1) / w;
+
+	bn_null(t);
+	bn_null(x);
+	bn_null(r);
+	bn_null(s);
+
+	TRY {
+		bn_new_size(t, 2 * digs);
+		bn_new_size(x, digs + 1);
+		bn_new_size(r, digs);
+		bn_new_size(s, digs + 1);
+
+		/* Reduce the basis and convert it to Montgomery form. */
+		bn_mxp_red(x->dp, a, m, digs, s->dp);
+		dv_zero(r->dp, digs);
+		dv_copy(r->dp, ctx->r2->dp, ctx->r2->used);
+		bn_mxp_mul(x->dp, x->dp, r->dp, m, u, digs, t->dp);
+
+		/* Create table of all powers up to 2^w - 1. */
+		dv_zero(r->dp, digs);
+		dv_copy(r->dp, ctx->one->dp, ctx->one->used);
+		bn_mxp_scatter(tab, r->dp, 0, n, digs);
+		bn_mxp_scatter(tab, x->dp, 1, n, digs);
+		dv_copy(r->dp, x->dp, digs);
+		for (i = 2; i < n; i++) {
+			bn_mxp_mul(r->dp, r->dp, x->dp, m, u, digs, t->dp);
+			bn_mxp_scatter(tab, r->dp, i, n, digs);
+		}
+
+		for (i = l - 1; i >= 0; i--) {
+			k = 0;
+			for (j = w - 1; j >= 0; j--) {
+				k = (k << 1) | bn_get_bit(b, i * w + j);
+			}
+			if (i == l - 1) {
+				bn_mxp_gather(r->dp, tab, k, n, digs);
+			} else {
+				for (j = 0; j < w; j++) {
+					bn_mxp_sqr(r->dp, r->dp, m, u, digs, t->dp);
+				}
+				bn_mxp_gather(x->dp, tab, k, n, digs);
+				bn_mxp_mul(r->dp, r->dp, x->dp, m, u, digs, t->dp);
+			}
+		}
+
+		/* Convert back from Montgomery form before trimming the result. */
+		dv_zero(t->dp, 2 * digs);
+		dv_copy(t->dp, r->dp, digs);
+		bn_mxp_rdc(r->dp, t->dp, m, u, digs);
+		bn_grow(c, digs);
+		dv_copy(c->dp, r->dp, digs);
+		c->used = digs;
+		c->sign = BN_POS;
+		bn_trim(c);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(x);
+		bn_free(r);
+		bn_free(s);
+	}
+}
+
+#if BN_MOD == MONTY || (defined(WITH_FP) && FP_RDC == MONTY) || !defined(STRIP)
+
+void bn_mont_mxp(bn_t c, const bn_t a, const bn_t b, const bn_mont_t ctx) {
+	bn_t tab[TABLE_SIZE], t, r;
+	int i, j, l, w;
+	uint8_t win[BN_BITS + 1];
+
+	if (bn_is_zero(b)) {
+		bn_copy(c, ctx->one);
+		return;
+	}
+
+	w = bn_mxp_width(bn_bits(b));
+
+	bn_null(t);
+	bn_null(r);
+	for (i = 0; i < (1 << w); i++) {
+		bn_null(tab[i]);
+	}
+
+	TRY {
+		for (i = 1; i < (1 << w); i += 2) {
+			bn_new(tab[i]);
+		}
+		bn_new(t);
+		bn_new(r);
+
+		/* Create table of odd powers. */
+		bn_copy(tab[1], a);
+		bn_mont_sqr(t, a, ctx);
+		for (i = 1; i < 1 << (w - 1); i++) {
+			bn_mont_mul(tab[2 * i + 1], tab[2 * i - 1], t, ctx);
+		}
+
+		l = BN_BITS + 1;
+		bn_rec_slw(win, &l, b, w);
+		bn_copy(r, ctx->one);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				bn_mont_sqr(r, r, ctx);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					bn_mont_sqr(r, r, ctx);
+				}
+				bn_mont_mul(r, r, tab[win[i]], ctx);
+			}
+		}
+		bn_trim(r);
+		bn_copy(c, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 1; i < (1 << w); i += 2) {
+			bn_free(tab[i]);
+		}
+		bn_free(t);
+		bn_free(r);
+	}
+}
+
+#endif
+
 void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m) {
 	int i, l;
 	bn_t t, u, r;
@@ -316,3 +681,273 @@ void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m) {
 		bn_free(r);
 	}
 }
+
+/**
+ * Returns the number of exponent bits covered by each column of the comb used
+ * for fixed-base exponentiation.
+ *
+ * @param[in] bits			- the maximum length in bits of the exponents.
+ * @return the length of the comb.
+ */
+static int bn_mxp_comb(int bits) {
+	return MAX(1, (bits + BN_DEPTH - 1) / BN_DEPTH);
+}
+
+void bn_mxp_pre(bn_t *t, const bn_t a, int bits, const bn_t m) {
+	int i, j, l;
+	bn_t u;
+
+	bn_null(u);
+
+	TRY {
+		bn_new(u);
+		bn_mod_pre(u, m);
+
+		/* Each column of the comb covers l bits of the exponent. */
+		l = bn_mxp_comb(bits);
+
+#if BN_MOD == MONTY
+		bn_mod_monty_conv(t[1], a, m);
+#else
+		bn_mod_basic(t[1], a, m);
+#endif
+
+		/* Compute t[2^j] = a^(2^(j * l)). */
+		for (j = 1; j < BN_DEPTH; j++) {
+			bn_copy(t[1 << j], t[1 << (j - 1)]);
+			for (i = 0; i < l; i++) {
+				bn_sqr(t[1 << j], t[1 << j]);
+				bn_mod(t[1 << j], t[1 << j], m, u);
+			}
+		}
+
+		/* Combine the powers of two into the remaining entries. */
+		for (j = 1; j < BN_DEPTH; j++) {
+			for (i = 1; i < (1 << j); i++) {
+				bn_mul(t[(1 << j) + i], t[1 << j], t[i]);
+				bn_mod(t[(1 << j) + i], t[(1 << j) + i], m, u);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(u);
+	}
+}
+
+void bn_mxp_fix(bn_t c, const bn_t *t, const bn_t b, int bits,
+		const bn_t m) {
+	int i, j, l, s, w;
+	bn_t u, r;
+
+	if (bn_is_zero(b)) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	l = bn_mxp_comb(bits);
+	if (bn_bits(b) > l * BN_DEPTH) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bn_null(u);
+	bn_null(r);
+
+	TRY {
+		bn_new(u);
+		bn_new(r);
+		bn_mod_pre(u, m);
+
+#if BN_MOD == MONTY
+		bn_set_dig(r, 1);
+		bn_mod_monty_conv(r, r, m);
+#else
+		bn_set_dig(r, 1);
+#endif
+
+		/* Squarings are skipped until the first nonzero column. */
+		for (s = 0, i = l - 1; i >= 0; i--) {
+			if (s) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+			}
+			w = 0;
+			for (j = BN_DEPTH - 1; j >= 0; j--) {
+				w = (w << 1) | bn_get_bit(b, j * l + i);
+			}
+			if (w > 0) {
+				if (s) {
+					bn_mul(r, r, t[w]);
+					bn_mod(r, r, m, u);
+				} else {
+					bn_copy(r, t[w]);
+					s = 1;
+				}
+			}
+		}
+		bn_trim(r);
+#if BN_MOD == MONTY
+		bn_mod_monty_back(c, r, m);
+#else
+		bn_copy(c, r);
+#endif
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(u);
+		bn_free(r);
+	}
+}
+
+void bn_mxp_sim(bn_t c, const bn_t a, const bn_t b, const bn_t d,
+		const bn_t e, const bn_t m) {
+	bn_t t[2], u[2];
+
+	for (int i = 0; i < 2; i++) {
+		bn_null(t[i]);
+		bn_null(u[i]);
+	}
+
+	TRY {
+		for (int i = 0; i < 2; i++) {
+			bn_new(t[i]);
+			bn_new(u[i]);
+		}
+		bn_copy(t[0], a);
+		bn_copy(t[1], d);
+		bn_copy(u[0], b);
+		bn_copy(u[1], e);
+		bn_mxp_sim_lot(c, (const bn_t *)t, (const bn_t *)u, m, 2);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (int i = 0; i < 2; i++) {
+			bn_free(t[i]);
+			bn_free(u[i]);
+		}
+	}
+}
+
+void bn_mxp_sim_lot(bn_t c, const bn_t a[], const bn_t b[], const bn_t m,
+		int n) {
+	int i, j, h, l, s, w;
+	uint8_t *win;
+	bn_t u, r, *tab;
+
+	if (n <= 0) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	l = 0;
+	for (i = 0; i < n; i++) {
+		l = MAX(l, bn_bits(b[i]));
+	}
+
+	if (l == 0) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	/* Shrink the windows so that all tables fit in the usual space. */
+	w = bn_mxp_width(l);
+	while (w > 1 && (n << (w - 1)) > TABLE_SIZE) {
+		w--;
+	}
+	h = 1 << (w - 1);
+
+	/* Both arrays grow with n, so keep them off the stack. */
+	win = (uint8_t *)malloc(n * l * sizeof(uint8_t));
+	tab = (bn_t *)malloc(n * h * sizeof(bn_t));
+	if (win == NULL || tab == NULL) {
+		free(win);
+		free(tab);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(u);
+	bn_null(r);
+	for (i = 0; i < n * h; i++) {
+		bn_null(tab[i]);
+	}
+
+	TRY {
+		bn_new(u);
+		bn_new(r);
+		for (i = 0; i < n * h; i++) {
+			bn_new(tab[i]);
+		}
+		bn_mod_pre(u, m);
+
+		/* Build the table of odd powers of each basis. */
+		for (i = 0; i < n; i++) {
+#if BN_MOD == MONTY
+			bn_mod_monty_conv(tab[i * h], a[i], m);
+#else
+			bn_mod_basic(tab[i * h], a[i], m);
+#endif
+			if (h > 1) {
+				bn_sqr(r, tab[i * h]);
+				bn_mod(r, r, m, u);
+				for (j = 1; j < h; j++) {
+					bn_mul(tab[i * h + j], tab[i * h + j - 1], r);
+					bn_mod(tab[i * h + j], tab[i * h + j], m, u);
+				}
+			}
+			bn_mxp_rec(win + i * l, l, b[i], w);
+		}
+
+#if BN_MOD == MONTY
+		bn_set_dig(r, 1);
+		bn_mod_monty_conv(r, r, m);
+#else
+		bn_set_dig(r, 1);
+#endif
+
+		/* Share the squarings among all the exponents. */
+		for (s = 0, j = l - 1; j >= 0; j--) {
+			if (s) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+			}
+			for (i = 0; i < n; i++) {
+				w = win[i * l + j];
+				if (w != 0) {
+					if (s) {
+						bn_mul(r, r, tab[i * h + w / 2]);
+						bn_mod(r, r, m, u);
+					} else {
+						bn_copy(r, tab[i * h + w / 2]);
+						s = 1;
+					}
+				}
+			}
+		}
+		bn_trim(r);
+#if BN_MOD == MONTY
+		bn_mod_monty_back(c, r, m);
+#else
+		bn_copy(c, r);
+#endif
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(u);
+		bn_free(r);
+		for (i = 0; i < n * h; i++) {
+			bn_free(tab[i]);
+		}
+		free(win);
+		free(tab);
+	}
+}
@@ -32,7 +32,10 @@
  * @ingroup bn
  */
 
+#include <string.h>
+
 #include "relic_core.h"
+#include "relic_rand.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -166,6 +169,233 @@ static void bn_exp(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 
 #endif
 
+/**
+ * Number of threads searching for primes in parallel.
+ */
+#ifdef MULTI
+#define GEN_THREADS		CORES
+#else
+#define GEN_THREADS		1
+#endif
+
+/**
+ * Represents the state shared by the threads of a parallel prime search.
+ */
+typedef struct {
+	/** The primes found so far. */
+	bn_st *p[2];
+	/** The number of primes found so far. */
+	int found;
+	/** The flag indicating that some thread failed. */
+	int error;
+	/** The length of the primes in bits. */
+	int bits;
+#if RAND != CALL
+	/** Independent seeds for the generators of the helper threads. */
+	uint8_t seed[GEN_THREADS][SEED_SIZE];
+#endif
+#if MULTI == PTHREAD
+	/** Lock protecting the primes found so far. */
+	pthread_mutex_t lock;
+#endif
+} gen_t;
+
+/**
+ * Stores a prime found by a search thread, unless it duplicates the one
+ * already found, and returns the number of primes found so far. A null
+ * candidate only queries the number of primes found. A failing thread stops
+ * the search for all threads.
+ *
+ * @param[in,out] gen		- the search state.
+ * @param[in] a				- the prime found or NULL.
+ * @param[in] fail			- the flag indicating that the thread failed.
+ * @return the number of primes found.
+ */
+static int bn_gen_put(gen_t *gen, const bn_t a, int fail) {
+	int r;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&(gen->lock));
+#elif MULTI == OPENMP
+#pragma omp critical (relic_prime)
+#endif
+	{
+		if (a != NULL && gen->found < 2) {
+			if (gen->found == 0 || bn_cmp(gen->p[0], a) != CMP_EQ) {
+				bn_copy(gen->p[gen->found], a);
+				gen->found++;
+			}
+		}
+		if (fail) {
+			gen->error = 1;
+			gen->found = 2;
+		}
+		r = gen->found;
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&(gen->lock));
+#endif
+	return r;
+}
+
+/**
+ * Searches for a probable prime among the candidates a, a + step, a + 2 * step,
+ * ... with at most the given length. The residues of the current candidate
+ * modulo the small primes are updated incrementally, so only the candidates
+ * surviving the sieve are given to the Miller-Rabin test. The candidates must
+ * be odd and the step must be even. If safe is set, (a - 1)/2 must also be
+ * prime.
+ *
+ * @param[in,out] a			- the first candidate and the prime found.
+ * @param[in] step			- the distance between consecutive candidates.
+ * @param[in] bits			- the maximum length of the candidates in bits.
+ * @param[in] safe			- the flag to search for a safe prime.
+ * @param[in] gen			- the state of a parallel search, or NULL.
+ * @return 1 if a prime was found, 0 otherwise.
+ */
+static int bn_gen_sieve(bn_t a, const bn_t step, int bits, int safe,
+		gen_t *gen) {
+	dig_t r[BASIC_TESTS], s[BASIC_TESTS];
+	int i, ok, found = 0, small;
+	bn_t q;
+
+	bn_null(q);
+
+	TRY {
+		bn_new(q);
+
+		/* Candidates within the table would be sieved out by themselves. */
+		small = (bn_bits(a) <= util_bits_dig(primes[BASIC_TESTS - 1]) + 1);
+		if (!small) {
+			for (i = 1; i < BASIC_TESTS; i++) {
+				bn_mod_dig(&r[i], a, primes[i]);
+				bn_mod_dig(&s[i], step, primes[i]);
+			}
+		}
+
+		while (bn_bits(a) <= bits) {
+			ok = 1;
+			if (!small) {
+				for (i = 1; i < BASIC_TESTS; i++) {
+					/* For safe primes, reject p | a and p | (a - 1)/2. */
+					if (r[i] == 0 || (safe && r[i] == 1)) {
+						ok = 0;
+						break;
+					}
+				}
+			}
+			if (ok && gen != NULL && bn_gen_put(gen, NULL, 0) == 2) {
+				break;
+			}
+			if (ok) {
+				if (safe) {
+					bn_rsh(q, a, 1);
+					ok = (small ? bn_is_prime(q) && bn_is_prime(a) :
+							bn_is_prime_rabin(q) && bn_is_prime_rabin(a));
+				} else {
+					ok = (small ? bn_is_prime(a) : bn_is_prime_rabin(a));
+				}
+				if (ok) {
+					found = 1;
+					break;
+				}
+			}
+			bn_add(a, a, step);
+			if (!small) {
+				for (i = 1; i < BASIC_TESTS; i++) {
+					r[i] += s[i];
+					if (r[i] >= primes[i]) {
+						r[i] -= primes[i];
+					}
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(q);
+	}
+	return found;
+}
+
+/**
+ * Searches for primes incrementally from random odd starting points until
+ * two distinct primes were found by any thread.
+ *
+ * @param[in,out] gen		- the search state.
+ * @param[in] id			- the thread identifier, zero for the caller.
+ */
+static void bn_gen_run(gen_t *gen, int id) {
+	bn_t t, u;
+	int bits = gen->bits;
+
+	if (id != 0) {
+		/* Helper threads need their own library context. */
+		core_init();
+#if RAND != CALL
+		rand_seed(gen->seed[id], SEED_SIZE);
+#endif
+	}
+
+	bn_null(t);
+	bn_null(u);
+
+	TRY {
+		bn_new(t);
+		bn_new(u);
+
+		bn_set_dig(u, 2);
+		while (bn_gen_put(gen, NULL, 0) < 2) {
+			bn_rand(t, BN_POS, bits);
+			bn_set_bit(t, bits - 1, 1);
+			bn_set_bit(t, 0, 1);
+			/* Step through odd candidates instead of drawing new ones. */
+			if (bn_gen_sieve(t, u, bits, 0, gen)) {
+				bn_gen_put(gen, t, 0);
+			}
+		}
+	}
+	CATCH_ANY {
+		bn_gen_put(gen, NULL, 1);
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(u);
+	}
+
+	if (id != 0) {
+		core_clean();
+	}
+}
+
+#if MULTI == PTHREAD
+
+/**
+ * Identifies a helper thread of a parallel prime search.
+ */
+typedef struct {
+	/** The shared search state. */
+	gen_t *gen;
+	/** The thread identifier. */
+	int id;
+} gen_arg_t;
+
+/**
+ * Entry point of helper threads in a parallel prime search.
+ *
+ * @param[in] arg			- the thread identifier and search state.
+ * @return NULL.
+ */
+static void *bn_gen_thread(void *arg) {
+	gen_arg_t *t = (gen_arg_t *)arg;
+	bn_gen_run(t->gen, t->id);
+	return NULL;
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -390,13 +620,25 @@ int bn_is_prime_solov(const bn_t a) {
 #if BN_GEN == BASIC || !defined(STRIP)
 
 void bn_gen_prime_basic(bn_t a, int bits) {
-	while (1) {
+	bn_t t;
+
+	bn_null(t);
+
+	TRY {
+		bn_new(t);
+
+		bn_set_dig(t, 2);
 		do {
 			bn_rand(a, BN_POS, bits);
-		} while (bn_bits(a) != bits);
-		if (bn_is_prime(a)) {
-			return;
-		}
+			bn_set_bit(a, bits - 1, 1);
+			bn_set_bit(a, 0, 1);
+		} while (!bn_gen_sieve(a, t, bits, 0, NULL));
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
 	}
 }
 
@@ -405,22 +647,27 @@ void bn_gen_prime_basic(bn_t a, int bits) {
 #if BN_GEN == SAFEP || !defined(STRIP)
 
 void bn_gen_prime_safep(bn_t a, int bits) {
-	while (1) {
+	bn_t t;
+
+	bn_null(t);
+
+	TRY {
+		bn_new(t);
+
+		/* Keep a = 3 mod 4, so that (a - 1)/2 is odd. */
+		bn_set_dig(t, 4);
 		do {
 			bn_rand(a, BN_POS, bits);
-		} while (bn_bits(a) != bits);
-		/* Check if (a - 1)/2 is prime. */
-		bn_sub_dig(a, a, 1);
-		bn_rsh(a, a, 1);
-		if (bn_is_prime(a)) {
-			/* Restore a. */
-			bn_lsh(a, a, 1);
-			bn_add_dig(a, a, 1);
-			if (bn_is_prime(a)) {
-				/* Should be prime now. */
-				return;
-			}
-		}
+			bn_set_bit(a, bits - 1, 1);
+			bn_set_bit(a, 1, 1);
+			bn_set_bit(a, 0, 1);
+		} while (!bn_gen_sieve(a, t, bits, 1, NULL));
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
 	}
 }
 
@@ -431,37 +678,37 @@ void bn_gen_prime_safep(bn_t a, int bits) {
 void bn_gen_prime_stron(bn_t a, int bits) {
 	dig_t i, j;
 	int found, k;
-	bn_t r, s, t;
+	bn_t r, s, t, u;
 
 	bn_null(r);
 	bn_null(s);
 	bn_null(t);
+	bn_null(u);
 
 	TRY {
 		bn_new(r);
 		bn_new(s);
 		bn_new(t);
+		bn_new(u);
 
 		do {
+			/* Generate two large primes r and s. */
+			bn_set_dig(u, 2);
 			do {
-				/* Generate two large primes r and s. */
 				bn_rand(s, BN_POS, bits / 2 - BN_DIGIT / 2);
+				bn_set_bit(s, 0, 1);
+			} while (!bn_gen_sieve(s, u, bits / 2 - BN_DIGIT / 2, 0, NULL));
+			do {
 				bn_rand(t, BN_POS, bits / 2 - BN_DIGIT / 2);
-			} while (!bn_is_prime(s) || !bn_is_prime(t));
-			found = 1;
+				bn_set_bit(t, 0, 1);
+			} while (!bn_gen_sieve(t, u, bits / 2 - BN_DIGIT / 2, 0, NULL));
 			bn_rand(a, BN_POS, bits / 2 - bn_bits(t) - 1);
 			i = a->dp[0];
 			bn_dbl(t, t);
-			do {
-				/* Find first prime r = 2 * i * t + 1. */
-				bn_mul_dig(r, t, i);
-				bn_add_dig(r, r, 1);
-				i++;
-				if (bn_bits(r) > bits / 2 - 1) {
-					found = 0;
-					break;
-				}
-			} while (!bn_is_prime(r));
+			/* Find first prime r = 2 * i * t + 1. */
+			bn_mul_dig(r, t, i);
+			bn_add_dig(r, r, 1);
+			found = bn_gen_sieve(r, t, bits / 2 - 1, 0, NULL);
 			if (found == 0) {
 				continue;
 			}
@@ -481,18 +728,12 @@ void bn_gen_prime_stron(bn_t a, int bits) {
 			k -= bn_bits(s);
 			bn_rand(a, BN_POS, k);
 			j = a->dp[0];
-			do {
-				/* Find first prime a = t + 2 * j * r * s. */
-				bn_mul(a, r, s);
-				bn_mul_dig(a, a, j);
-				bn_dbl(a, a);
-				bn_add(a, a, t);
-				j++;
-				if (bn_bits(a) > bits) {
-					found = 0;
-					break;
-				}
-			} while (!bn_is_prime(a));
+			/* Find first prime a = t + 2 * j * r * s. */
+			bn_mul(u, r, s);
+			bn_dbl(u, u);
+			bn_mul_dig(a, u, j);
+			bn_add(a, a, t);
+			found = bn_gen_sieve(a, u, bits, 0, NULL);
 		} while (found == 0 && bn_bits(a) != bits);
 	}
 	CATCH_ANY {
@@ -502,7 +743,54 @@ void bn_gen_prime_stron(bn_t a, int bits) {
 		bn_free(r);
 		bn_free(s);
 		bn_free(t);
+		bn_free(u);
 	}
 }
 
 #endif
+
+void bn_gen_prime_par(bn_t a, bn_t b, int bits) {
+	gen_t gen;
+
+	gen.p[0] = a;
+	gen.p[1] = b;
+	gen.found = 0;
+	gen.error = 0;
+	gen.bits = bits;
+#if RAND != CALL
+	for (int i = 1; i < GEN_THREADS; i++) {
+		rand_bytes(gen.seed[i], SEED_SIZE);
+	}
+#endif
+
+#if MULTI == PTHREAD
+	pthread_t threads[GEN_THREADS];
+	gen_arg_t args[GEN_THREADS];
+	int i;
+
+	pthread_mutex_init(&(gen.lock), NULL);
+	for (i = 1; i < GEN_THREADS; i++) {
+		args[i].gen = &gen;
+		args[i].id = i;
+		if (pthread_create(&threads[i], NULL, bn_gen_thread, &args[i]) != 0) {
+			break;
+		}
+	}
+	bn_gen_run(&gen, 0);
+	while (--i > 0) {
+		pthread_join(threads[i], NULL);
+	}
+	pthread_mutex_destroy(&(gen.lock));
+#elif MULTI == OPENMP
+#pragma omp parallel num_threads(GEN_THREADS) shared(gen)
+	{
+		bn_gen_run(&gen, omp_get_thread_num());
+	}
+#else
+	bn_gen_run(&gen, 0);
+#endif
+
+	if (gen.error) {
+		THROW(ERR_CAUGHT);
+	}
+}
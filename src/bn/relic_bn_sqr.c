@@ -90,7 +90,7 @@ static void bn_sqr_karat_imp(bn_t c, const bn_t a, int level) {
 #if BN_SQR == BASIC
 			bn_sqr_basic(a0a0, a0);
 			bn_sqr_basic(a1a1, a1);
-#elif BN_SQR == COMBA
+#elif BN_SQR == COMBA || BN_SQR == ADAPT
 			bn_sqr_comba(a0a0, a0);
 			bn_sqr_comba(a1a1, a1);
 #elif BN_SQR == MULTP
@@ -109,7 +109,7 @@ static void bn_sqr_karat_imp(bn_t c, const bn_t a, int level) {
 			/* t = (a1 + a0)*(a1 + a0) */
 #if BN_SQR == BASIC
 			bn_sqr_basic(t, t);
-#elif BN_SQR == COMBA
+#elif BN_SQR == COMBA || BN_SQR == ADAPT
 			bn_sqr_comba(t, t);
 #elif BN_SQR == MULTP
 			bn_mul_comba(t, t, t);
@@ -188,7 +188,7 @@ void bn_sqr_basic(bn_t c, const bn_t a) {
 
 #endif
 
-#if BN_SQR == COMBA || !defined(STRIP)
+#if BN_SQR == COMBA || BN_SQR == ADAPT || !defined(STRIP)
 
 void bn_sqr_comba(bn_t c, const bn_t a) {
 	int digits;
@@ -225,3 +225,19 @@ void bn_sqr_karat(bn_t c, const bn_t a) {
 }
 
 #endif
+
+#if BN_SQR == ADAPT || !defined(STRIP)
+
+void bn_sqr_adapt(bn_t c, const bn_t a) {
+	if (a->used >= MAX(BN_TOOM3, 3)) {
+		bn_mul_toom3(c, a, a);
+	} else {
+#if BN_KARAT > 0
+		bn_sqr_karat(c, a);
+#else
+		bn_sqr_comba(c, a);
+#endif
+	}
+}
+
+#endif
@@ -29,10 +29,81 @@
  * @ingroup cp
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "relic.h"
 #include "relic_test.h"
 #include "relic_bench.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Represents a message to be checked for repetitions.
+ */
+typedef struct {
+	/** The message. */
+	uint8_t *msg;
+	/** The message length in bytes. */
+	int len;
+} bls_msg_t;
+
+/**
+ * Compares two messages by length and then by content, as required by qsort().
+ *
+ * @param[in] a				- the first message.
+ * @param[in] b				- the second message.
+ * @return a negative, zero or positive value if the first message is smaller,
+ * equal or larger than the second.
+ */
+static int bls_msg_cmp(const void *a, const void *b) {
+	const bls_msg_t *x = (const bls_msg_t *)a, *y = (const bls_msg_t *)b;
+
+	if (x->len != y->len) {
+		return (x->len < y->len ? -1 : 1);
+	}
+	return memcmp(x->msg, y->msg, x->len);
+}
+
+/**
+ * Checks if a set of messages has no repetitions, by sorting the messages and
+ * comparing neighbors.
+ *
+ * @param[in] msg				- the messages.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] n					- the number of messages.
+ * @return 1 if the messages are distinct, 0 otherwise.
+ */
+static int bls_distinct(uint8_t **msg, int *len, int n) {
+	bls_msg_t *t;
+	int i, result = 1;
+
+	if (n < 2) {
+		return 1;
+	}
+
+	t = (bls_msg_t *)malloc(n * sizeof(bls_msg_t));
+	if (t == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return 0;
+	}
+
+	for (i = 0; i < n; i++) {
+		t[i].msg = msg[i];
+		t[i].len = len[i];
+	}
+	qsort(t, n, sizeof(bls_msg_t), bls_msg_cmp);
+	for (i = 1; i < n && result; i++) {
+		if (bls_msg_cmp(&t[i - 1], &t[i]) == 0) {
+			result = 0;
+		}
+	}
+	free(t);
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -70,6 +141,8 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d) {
 
 	g1_null(p);
 
+	arena_open();
+
 	TRY {
 		g1_new(p);
 		g1_map(p, msg, len);
@@ -81,33 +154,117 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d) {
 	FINALLY {
 		g1_free(p);
 	}
+	arena_close();
 	return result;
 }
 
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
-	g1_t p;
-	g2_t g;
-	gt_t e1, e2;
+	g1_t p[2];
+	g2_t g[2];
+	gt_t e;
 	int result = 0;
 
-	g1_null(p);
-	g2_null(g);
-	gt_null(e1);
-	gt_null(e2);
+	g1_null(p[0]);
+	g1_null(p[1]);
+	g2_null(g[0]);
+	g2_null(g[1]);
+	gt_null(e);
+
+	arena_open();
 
 	TRY {
-		g1_new(p);
-		g2_new(g);
-		gt_new(e1);
-		gt_new(e2);
+		g1_new(p[0]);
+		g1_new(p[1]);
+		g2_new(g[0]);
+		g2_new(g[1]);
+		gt_new(e);
 
-		g2_get_gen(g);
+		g1_map(p[0], msg, len);
+		g1_neg(p[1], s);
+		g2_copy(g[0], q);
+		g2_get_gen(g[1]);
 
-		g1_map(p, msg, len);
-		pc_map(e1, p, q);
-		pc_map(e2, s, g);
+		/* Check that e(H(m), q) * e(-s, g) = 1. */
+		pc_map_sim(e, p, g, 2);
+		if (gt_is_unity(e)) {
+			result = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g1_free(p[0]);
+		g1_free(p[1]);
+		g2_free(g[0]);
+		g2_free(g[1]);
+		gt_free(e);
+	}
+	arena_close();
+	return result;
+}
+
+int cp_bls_agg(g1_t s, g1_t *sig, int n) {
+	int result = STS_OK;
 
-		if (gt_cmp(e1, e2) == CMP_EQ) {
+	TRY {
+		g1_set_infty(s);
+		for (int i = 0; i < n; i++) {
+			g1_add(s, s, sig[i]);
+		}
+		g1_norm(s, s);
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	return result;
+}
+
+int cp_bls_ver_agg(g1_t s, uint8_t **msg, int *len, g2_t *q, int n) {
+	g1_t *p;
+	g2_t *g;
+	gt_t e;
+	int result = 0;
+
+	/* Rogue-key attacks are only prevented if all messages are distinct. */
+	if (!bls_distinct(msg, len, n)) {
+		return 0;
+	}
+
+	p = (g1_t *)malloc((n + 1) * sizeof(g1_t));
+	g = (g2_t *)malloc((n + 1) * sizeof(g2_t));
+	if (p == NULL || g == NULL) {
+		free(p);
+		free(g);
+		THROW(ERR_NO_MEMORY);
+		return 0;
+	}
+
+	for (int i = 0; i <= n; i++) {
+		g1_null(p[i]);
+		g2_null(g[i]);
+	}
+	gt_null(e);
+
+	arena_open();
+
+	TRY {
+		for (int i = 0; i <= n; i++) {
+			g1_new(p[i]);
+			g2_new(g[i]);
+		}
+		gt_new(e);
+
+		for (int i = 0; i < n; i++) {
+			g1_map(p[i], msg[i], len[i]);
+			g2_copy(g[i], q[i]);
+		}
+		g1_neg(p[n], s);
+		g2_get_gen(g[n]);
+
+		/* Check that e(H(m_1), q_1) * ... * e(H(m_n), q_n) * e(-s, g) = 1. */
+		pc_map_sim(e, p, g, n + 1);
+		if (gt_is_unity(e)) {
 			result = 1;
 		}
 	}
@@ -115,10 +272,92 @@ int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		g1_free(p);
-		g2_free(g);
-		gt_free(e1);
-		gt_free(e2);
+		for (int i = 0; i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(g[i]);
+		}
+		gt_free(e);
+		free(p);
+		free(g);
+	}
+	arena_close();
+	return result;
+}
+
+int cp_bls_ver_batch(g1_t *s, uint8_t **msg, int *len, g2_t *q, int n) {
+	g1_t t, u, *p;
+	g2_t *g;
+	gt_t e;
+	bn_t r;
+	int result = 0;
+
+	p = (g1_t *)malloc((n + 1) * sizeof(g1_t));
+	g = (g2_t *)malloc((n + 1) * sizeof(g2_t));
+	if (p == NULL || g == NULL) {
+		free(p);
+		free(g);
+		THROW(ERR_NO_MEMORY);
+		return 0;
+	}
+
+	g1_null(t);
+	g1_null(u);
+	for (int i = 0; i <= n; i++) {
+		g1_null(p[i]);
+		g2_null(g[i]);
+	}
+	gt_null(e);
+	bn_null(r);
+
+	arena_open();
+
+	TRY {
+		g1_new(t);
+		g1_new(u);
+		for (int i = 0; i <= n; i++) {
+			g1_new(p[i]);
+			g2_new(g[i]);
+		}
+		gt_new(e);
+		bn_new(r);
+
+		/* Combine the equations with random small exponents r_i. */
+		g1_set_infty(t);
+		for (int i = 0; i < n; i++) {
+			do {
+				bn_rand(r, BN_POS, CP_BATCH);
+			} while (bn_is_zero(r));
+			g1_map(p[i], msg[i], len[i]);
+			g1_mul(p[i], p[i], r);
+			g1_mul(u, s[i], r);
+			g1_add(t, t, u);
+			g2_copy(g[i], q[i]);
+		}
+		g1_norm(t, t);
+		g1_neg(p[n], t);
+		g2_get_gen(g[n]);
+
+		/* Check that prod e(r_i * H(m_i), q_i) * e(-sum r_i * s_i, g) = 1. */
+		pc_map_sim(e, p, g, n + 1);
+		if (gt_is_unity(e)) {
+			result = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g1_free(t);
+		g1_free(u);
+		for (int i = 0; i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(g[i]);
+		}
+		gt_free(e);
+		bn_free(r);
+		free(p);
+		free(g);
 	}
+	arena_close();
 	return result;
 }
@@ -76,6 +76,8 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 	bn_null(e);
 	ec_null(p);
 
+	arena_open();
+
 	TRY {
 		bn_new(n);
 		bn_new(k);
@@ -113,10 +115,8 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 			bn_mod(s, s, n);
 			bn_add(s, s, e);
 			bn_mod(s, s, n);
-			bn_gcd_ext(x, k, NULL, k, n);
-			if (bn_sign(k) == BN_NEG) {
-				bn_add(k, k, n);
-			}
+			/* The nonce is secret, so invert it in constant time. */
+			bn_mod_inv_const(k, k, n);
 			bn_mul(s, s, k);
 			bn_mod(s, s, n);
 		} while (bn_is_zero(s));
@@ -131,6 +131,7 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 		bn_free(e);
 		ec_free(p);
 	}
+	arena_close();
 	return result;
 }
 
@@ -146,6 +147,8 @@ int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 	bn_null(v);
 	ec_null(p);
 
+	arena_open();
+
 	TRY {
 		bn_new(n);
 		bn_new(e);
@@ -209,5 +212,6 @@ int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
 		bn_free(k);
 		ec_free(p);
 	}
+	arena_close();
 	return result;
 }
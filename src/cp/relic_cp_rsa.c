@@ -583,6 +583,365 @@ static int pad_pkcs2(bn_t m, int *p_len, int m_len, int k_len, int operation) {
 
 #endif
 
+#if CP_RSA == QUICK || !defined(STRIP)
+
+/**
+ * Computes the RSA private operation with the CRT optimization. Both
+ * exponentiations run in constant time, whatever BN_MXP is.
+ *
+ * @param[in,out] eb		- the input and the result.
+ * @param[out] m			- a temporary integer.
+ * @param[in] prv			- the private key.
+ * @param[in] mp			- the Montgomery context of the first prime.
+ * @param[in] mq			- the Montgomery context of the second prime.
+ */
+static void rsa_crt(bn_t eb, bn_t m, rsa_t prv, const bn_mont_t mp,
+		const bn_mont_t mq) {
+	/* m1 = c^dP mod p, m2 = c^dQ mod q. */
+	bn_mont_mxp_consttime(m, eb, prv->dp, mp);
+	bn_mont_mxp_consttime(eb, eb, prv->dq, mq);
+	/* m1 = m1 - m2 mod p. */
+	bn_sub(m, m, eb);
+	while (bn_sign(m) == BN_NEG) {
+		bn_add(m, m, prv->p);
+	}
+	bn_mod(m, m, prv->p);
+	/* m1 = qInv(m1 - m2) mod p. */
+	bn_mul(m, m, prv->qi);
+	bn_mod(m, m, prv->p);
+	/* m = m2 + m1 * q. */
+	bn_mul(m, m, prv->q);
+	bn_add(eb, eb, m);
+}
+
+/**
+ * Decrypts a single ciphertext with the CRT optimization.
+ *
+ * @param[out] out			- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the input buffer.
+ * @param[in] in_len		- the number of bytes to decrypt.
+ * @param[out] m			- a temporary integer.
+ * @param[out] eb			- a temporary integer.
+ * @param[in] prv			- the private key.
+ * @param[in] mp			- the Montgomery context of the first prime.
+ * @param[in] mq			- the Montgomery context of the second prime.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+static int rsa_dec_one(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		bn_t m, bn_t eb, rsa_t prv, const bn_mont_t mp, const bn_mont_t mq) {
+	int size, pad_len, result = STS_OK;
+
+	size = bn_size_bin(prv->n);
+
+	if (in_len != size || in_len < RSA_PAD_LEN) {
+		return STS_ERR;
+	}
+
+	bn_read_bin(eb, in, in_len);
+	rsa_crt(eb, m, prv, mp, mq);
+
+	if (bn_cmp(eb, prv->n) != CMP_LT) {
+		return STS_ERR;
+	}
+#if CP_RSAPD == BASIC
+	if (pad_basic(eb, &pad_len, in_len, size, RSA_DEC) == STS_OK) {
+#elif CP_RSAPD == PKCS1
+	if (pad_pkcs1(eb, &pad_len, in_len, size, RSA_DEC) == STS_OK) {
+#elif CP_RSAPD == PKCS2
+	if (pad_pkcs2(eb, &pad_len, in_len, size, RSA_DEC) == STS_OK) {
+#endif
+		size = size - pad_len;
+
+		if (size <= *out_len) {
+			memset(out, 0, size);
+			bn_write_bin(out, size, eb);
+			*out_len = size;
+		} else {
+			result = STS_ERR;
+		}
+	} else {
+		result = STS_ERR;
+	}
+	return result;
+}
+
+/**
+ * Signs a single message with the CRT optimization.
+ *
+ * @param[out] sig			- the signature.
+ * @param[in, out] sig_len	- the buffer capacity and number of bytes written.
+ * @param[in] msg			- the message to sign.
+ * @param[in] msg_len		- the number of bytes to sign.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[out] m			- a temporary integer.
+ * @param[out] eb			- a temporary integer.
+ * @param[in] prv			- the private key.
+ * @param[in] mp			- the Montgomery context of the first prime.
+ * @param[in] mq			- the Montgomery context of the second prime.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+static int rsa_sig_one(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len,
+		int hash, bn_t m, bn_t eb, rsa_t prv, const bn_mont_t mp,
+		const bn_mont_t mq) {
+	int size, pad_len;
+	uint8_t h[MD_LEN];
+
+	if (msg_len < 0) {
+		return STS_ERR;
+	}
+
+	pad_len = (!hash ? MD_LEN : msg_len);
+
+#if CP_RSAPD == PKCS2
+	size = bn_bits(prv->n) - 1;
+	size = (size / 8) + (size % 8 > 0);
+	if (pad_len > (size - 2)) {
+		return STS_ERR;
+	}
+#else
+	size = bn_size_bin(prv->n);
+	if (pad_len > (size - RSA_PAD_LEN)) {
+		return STS_ERR;
+	}
+#endif
+
+	bn_zero(m);
+	bn_zero(eb);
+
+	int operation = (!hash ? RSA_SIG : RSA_SIG_HASH);
+
+#if CP_RSAPD == BASIC
+	if (pad_basic(eb, &pad_len, pad_len, size, operation) != STS_OK) {
+#elif CP_RSAPD == PKCS1
+	if (pad_pkcs1(eb, &pad_len, pad_len, size, operation) != STS_OK) {
+#elif CP_RSAPD == PKCS2
+	if (pad_pkcs2(eb, &pad_len, pad_len, size, operation) != STS_OK) {
+#endif
+		return STS_ERR;
+	}
+
+	if (!hash) {
+		md_map(h, msg, msg_len);
+		bn_read_bin(m, h, MD_LEN);
+		bn_add(eb, eb, m);
+	} else {
+		bn_read_bin(m, msg, msg_len);
+		bn_add(eb, eb, m);
+	}
+
+#if CP_RSAPD == PKCS2
+	pad_pkcs2(eb, &pad_len, bn_bits(prv->n), size, RSA_SIG_FIN);
+#endif
+
+	rsa_crt(eb, m, prv, mp, mq);
+	bn_mod(eb, eb, prv->n);
+
+	size = bn_size_bin(prv->n);
+	if (size > *sig_len) {
+		return STS_ERR;
+	}
+	memset(sig, 0, size);
+	bn_write_bin(sig, size, eb);
+	*sig_len = size;
+	return STS_OK;
+}
+
+/**
+ * Number of threads sharing a batch of private operations.
+ */
+#ifdef MULTI
+#define RSA_THREADS		CORES
+#else
+#define RSA_THREADS		1
+#endif
+
+/**
+ * Represents a batch of private operations under the same key.
+ */
+typedef struct {
+	/** The output buffers. */
+	uint8_t **out;
+	/** The output buffer capacities and numbers of bytes written. */
+	int *out_len;
+	/** The input buffers. */
+	uint8_t **in;
+	/** The numbers of input bytes. */
+	int *in_len;
+	/** The number of operations. */
+	int n;
+	/** The flag to indicate the message format for signatures. */
+	int hash;
+	/** The flag to select signatures instead of decryptions. */
+	int sig;
+	/** The private key. */
+	rsa_st *prv;
+	/** The Montgomery context of the first prime, shared by all threads. */
+	bn_mont_st *mp;
+	/** The Montgomery context of the second prime, shared by all threads. */
+	bn_mont_st *mq;
+	/** The number of threads sharing the batch. */
+	int threads;
+	/** The result of each thread. */
+	int result[RSA_THREADS];
+} rsa_bat_t;
+
+/**
+ * Processes the share of a batch assigned to a thread.
+ *
+ * @param[in,out] bat		- the batch.
+ * @param[in] id			- the thread identifier, zero for the caller.
+ */
+static void rsa_bat_run(rsa_bat_t *bat, int id) {
+	bn_t m, eb;
+	int i, result = STS_OK;
+
+	if (id != 0) {
+		/* Helper threads need their own library context. */
+		core_init();
+	}
+
+	bn_null(m);
+	bn_null(eb);
+
+	TRY {
+		bn_new(m);
+		bn_new(eb);
+
+		for (i = id; i < bat->n; i += bat->threads) {
+			if (bat->sig) {
+				if (rsa_sig_one(bat->out[i], &bat->out_len[i], bat->in[i],
+						bat->in_len[i], bat->hash, m, eb, bat->prv, bat->mp,
+						bat->mq) != STS_OK) {
+					result = STS_ERR;
+				}
+			} else {
+				if (rsa_dec_one(bat->out[i], &bat->out_len[i], bat->in[i],
+						bat->in_len[i], m, eb, bat->prv, bat->mp,
+						bat->mq) != STS_OK) {
+					result = STS_ERR;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	FINALLY {
+		bn_free(m);
+		bn_free(eb);
+	}
+	bat->result[id] = result;
+
+	if (id != 0) {
+		core_clean();
+	}
+}
+
+#if MULTI == PTHREAD
+
+/**
+ * Identifies a helper thread processing a batch.
+ */
+typedef struct {
+	/** The batch. */
+	rsa_bat_t *bat;
+	/** The thread identifier. */
+	int id;
+} rsa_arg_t;
+
+/**
+ * Entry point of helper threads processing a batch.
+ *
+ * @param[in] arg			- the thread identifier and batch.
+ * @return NULL.
+ */
+static void *rsa_bat_thread(void *arg) {
+	rsa_arg_t *t = (rsa_arg_t *)arg;
+	rsa_bat_run(t->bat, t->id);
+	return NULL;
+}
+
+#endif
+
+/**
+ * Processes a batch of private operations under the same key, spreading the
+ * operations among CORES threads if multithreading is enabled. The Montgomery
+ * contexts of the two primes are computed once and shared by all operations.
+ *
+ * @param[in,out] bat		- the batch.
+ * @param[in] prv			- the private key.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+static int rsa_bat(rsa_bat_t *bat, rsa_t prv) {
+	bn_mont_t mp, mq;
+	int i, result = STS_OK;
+
+	bn_mont_null(mp);
+	bn_mont_null(mq);
+
+	TRY {
+		bn_mont_new(mp);
+		bn_mont_new(mq);
+		bn_mont_set(mp, prv->p);
+		bn_mont_set(mq, prv->q);
+
+		bat->prv = prv;
+		bat->mp = mp;
+		bat->mq = mq;
+		bat->threads = MAX(1, MIN(RSA_THREADS, bat->n));
+		for (i = 0; i < bat->threads; i++) {
+			bat->result[i] = STS_ERR;
+		}
+
+#if MULTI == PTHREAD
+		pthread_t threads[RSA_THREADS];
+		rsa_arg_t args[RSA_THREADS];
+
+		for (i = 1; i < bat->threads; i++) {
+			args[i].bat = bat;
+			args[i].id = i;
+			if (pthread_create(&threads[i], NULL, rsa_bat_thread,
+					&args[i]) != 0) {
+				/* The share of this thread keeps its error result. */
+				break;
+			}
+		}
+		int created = i;
+		rsa_bat_run(bat, 0);
+		for (i = 1; i < created; i++) {
+			pthread_join(threads[i], NULL);
+		}
+#elif MULTI == OPENMP
+#pragma omp parallel num_threads(bat->threads) shared(bat)
+		{
+			if (omp_get_thread_num() < bat->threads) {
+				rsa_bat_run(bat, omp_get_thread_num());
+			}
+		}
+#else
+		rsa_bat_run(bat, 0);
+#endif
+
+		for (i = 0; i < bat->threads; i++) {
+			if (bat->result[i] != STS_OK) {
+				result = STS_ERR;
+			}
+		}
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	FINALLY {
+		bn_mont_free(mp);
+		bn_mont_free(mq);
+	}
+
+	return result;
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -605,10 +964,14 @@ int cp_rsa_gen_basic(rsa_t pub, rsa_t prv, int bits) {
 		bn_new(r);
 
 		/* Generate different primes p and q. */
+#if BN_GEN == BASIC
+		bn_gen_prime_par(prv->p, prv->q, bits / 2);
+#else
 		do {
 			bn_gen_prime(prv->p, bits / 2);
 			bn_gen_prime(prv->q, bits / 2);
 		} while (bn_cmp(prv->p, prv->q) == CMP_EQ);
+#endif
 
 		/* Swap p and q so that p is smaller. */
 		if (bn_cmp(prv->p, prv->q) == CMP_LT) {
@@ -668,10 +1031,14 @@ int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits) {
 		bn_new(r);
 
 		/* Generate different primes p and q. */
+#if BN_GEN == BASIC
+		bn_gen_prime_par(prv->p, prv->q, bits / 2);
+#else
 		do {
 			bn_gen_prime(prv->p, bits / 2);
 			bn_gen_prime(prv->q, bits / 2);
 		} while (bn_cmp(prv->p, prv->q) == CMP_EQ);
+#endif
 
 		/* Swap p and q so that p is smaller. */
 		if (bn_cmp(prv->p, prv->q) == CMP_LT) {
@@ -707,11 +1074,8 @@ int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits) {
 			bn_add_dig(prv->p, prv->p, 1);
 			bn_add_dig(prv->q, prv->q, 1);
 
-			/* qInv = q^(-1) mod p. */
-			bn_gcd_ext(r, prv->qi, NULL, prv->q, prv->p);
-			if (bn_sign(prv->qi) == BN_NEG) {
-				bn_add(prv->qi, prv->qi, prv->p);
-			}
+			/* qInv = q^(-1) mod p, computed in constant time. */
+			bn_mod_inv_const(prv->qi, prv->q, prv->p);
 
 			result = STS_OK;
 		}
@@ -806,7 +1170,7 @@ int cp_rsa_dec_basic(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 		bn_new(eb);
 
 		bn_read_bin(eb, in, in_len);
-		bn_mxp(eb, eb, prv->d, prv->n);
+		bn_mxp_consttime(eb, eb, prv->d, prv->n);
 
 		if (bn_cmp(eb, prv->n) != CMP_LT) {
 			result = STS_ERR;
@@ -848,66 +1212,27 @@ int cp_rsa_dec_basic(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 
 int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv) {
 	bn_t m, eb;
-	int size, pad_len, result = STS_OK;
-
-	bn_null(m);
-	bn_null(eb);
-
-	size = bn_size_bin(prv->n);
+	bn_mont_t mp, mq;
+	int result = STS_OK;
 
-	if (prv == NULL || in_len != size || in_len < RSA_PAD_LEN) {
+	if (prv == NULL) {
 		return STS_ERR;
 	}
 
+	bn_null(m);
+	bn_null(eb);
+	bn_mont_null(mp);
+	bn_mont_null(mq);
+
 	TRY {
 		bn_new(m);
 		bn_new(eb);
+		bn_mont_new(mp);
+		bn_mont_new(mq);
+		bn_mont_set(mp, prv->p);
+		bn_mont_set(mq, prv->q);
 
-		bn_read_bin(eb, in, in_len);
-
-		bn_copy(m, eb);
-
-		/* m1 = c^dP mod p. */
-		bn_mxp(eb, eb, prv->dp, prv->p);
-
-		/* m2 = c^dQ mod q. */
-		bn_mxp(m, m, prv->dq, prv->q);
-
-		/* m1 = m1 - m2 mod p. */
-		bn_sub(eb, eb, m);
-		while (bn_sign(eb) == BN_NEG) {
-			bn_add(eb, eb, prv->p);
-		}
-		bn_mod(eb, eb, prv->p);
-		/* m1 = qInv(m1 - m2) mod p. */
-		bn_mul(eb, eb, prv->qi);
-		bn_mod(eb, eb, prv->p);
-		/* m = m2 + m1 * q. */
-		bn_mul(eb, eb, prv->q);
-		bn_add(eb, eb, m);
-
-		if (bn_cmp(eb, prv->n) != CMP_LT) {
-			result = STS_ERR;
-		}
-#if CP_RSAPD == BASIC
-		if (pad_basic(eb, &pad_len, in_len, size, RSA_DEC) == STS_OK) {
-#elif CP_RSAPD == PKCS1
-		if (pad_pkcs1(eb, &pad_len, in_len, size, RSA_DEC) == STS_OK) {
-#elif CP_RSAPD == PKCS2
-		if (pad_pkcs2(eb, &pad_len, in_len, size, RSA_DEC) == STS_OK) {
-#endif
-			size = size - pad_len;
-
-			if (size <= *out_len) {
-				memset(out, 0, size);
-				bn_write_bin(out, size, eb);
-				*out_len = size;
-			} else {
-				result = STS_ERR;
-			}
-		} else {
-			result = STS_ERR;
-		}
+		result = rsa_dec_one(out, out_len, in, in_len, m, eb, prv, mp, mq);
 	}
 	CATCH_ANY {
 		result = STS_ERR;
@@ -915,6 +1240,8 @@ int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 	FINALLY {
 		bn_free(m);
 		bn_free(eb);
+		bn_mont_free(mp);
+		bn_mont_free(mq);
 	}
 
 	return result;
@@ -980,7 +1307,7 @@ int cp_rsa_sig_basic(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 			pad_pkcs2(eb, &pad_len, bn_bits(prv->n), size, RSA_SIG_FIN);
 #endif
 
-			bn_mxp(eb, eb, prv->d, prv->n);
+			bn_mxp_consttime(eb, eb, prv->d, prv->n);
 
 			size = bn_size_bin(prv->n);
 
@@ -1012,94 +1339,27 @@ int cp_rsa_sig_basic(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 
 int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int hash, rsa_t prv) {
 	bn_t m, eb;
-	int pad_len, size, result = STS_OK;
-	uint8_t h[MD_LEN];
-
-	if (prv == NULL || msg_len < 0) {
-		return STS_ERR;
-	}
-
-	pad_len = (!hash ? MD_LEN : msg_len);
+	bn_mont_t mp, mq;
+	int result = STS_OK;
 
-#if CP_RSAPD == PKCS2
-	size = bn_bits(prv->n) - 1;
-	size = (size / 8) + (size % 8 > 0);
-	if (pad_len > (size - 2)) {
-		return STS_ERR;
-	}
-#else
-	size = bn_size_bin(prv->n);
-	if (pad_len > (size - RSA_PAD_LEN)) {
+	if (prv == NULL) {
 		return STS_ERR;
 	}
-#endif
 
 	bn_null(m);
 	bn_null(eb);
+	bn_mont_null(mp);
+	bn_mont_null(mq);
 
 	TRY {
 		bn_new(m);
 		bn_new(eb);
+		bn_mont_new(mp);
+		bn_mont_new(mq);
+		bn_mont_set(mp, prv->p);
+		bn_mont_set(mq, prv->q);
 
-		bn_zero(m);
-		bn_zero(eb);
-
-		int operation = (!hash ? RSA_SIG : RSA_SIG_HASH);
-
-#if CP_RSAPD == BASIC
-		if (pad_basic(eb, &pad_len, pad_len, size, operation) == STS_OK) {
-#elif CP_RSAPD == PKCS1
-		if (pad_pkcs1(eb, &pad_len, pad_len, size, operation) == STS_OK) {
-#elif CP_RSAPD == PKCS2
-		if (pad_pkcs2(eb, &pad_len, pad_len, size, operation) == STS_OK) {
-#endif
-			if (!hash) {
-				md_map(h, msg, msg_len);
-				bn_read_bin(m, h, MD_LEN);
-				bn_add(eb, eb, m);
-			} else {
-				bn_read_bin(m, msg, msg_len);
-				bn_add(eb, eb, m);
-			}
-
-#if CP_RSAPD == PKCS2
-			pad_pkcs2(eb, &pad_len, bn_bits(prv->n), size, RSA_SIG_FIN);
-#endif
-
-			bn_copy(m, eb);
-
-			/* m1 = c^dP mod p. */
-			bn_mxp(eb, eb, prv->dp, prv->p);
-
-			/* m2 = c^dQ mod q. */
-			bn_mxp(m, m, prv->dq, prv->q);
-
-			/* m1 = m1 - m2 mod p. */
-			bn_sub(eb, eb, m);
-			while (bn_sign(eb) == BN_NEG) {
-				bn_add(eb, eb, prv->p);
-			}
-			bn_mod(eb, eb, prv->p);
-			/* m1 = qInv(m1 - m2) mod p. */
-			bn_mul(eb, eb, prv->qi);
-			bn_mod(eb, eb, prv->p);
-			/* m = m2 + m1 * q. */
-			bn_mul(eb, eb, prv->q);
-			bn_add(eb, eb, m);
-			bn_mod(eb, eb, prv->n);
-
-			size = bn_size_bin(prv->n);
-
-			if (size <= *sig_len) {
-				memset(sig, 0, size);
-				bn_write_bin(sig, size, eb);
-				*sig_len = size;
-			} else {
-				result = STS_ERR;
-			}
-		} else {
-			result = STS_ERR;
-		}
+		result = rsa_sig_one(sig, sig_len, msg, msg_len, hash, m, eb, prv, mp, mq);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -1107,6 +1367,8 @@ int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 	FINALLY {
 		bn_free(m);
 		bn_free(eb);
+		bn_mont_free(mp);
+		bn_mont_free(mq);
 	}
 
 	return result;
@@ -1215,3 +1477,43 @@ int cp_rsa_ver(uint8_t *sig, int sig_len, uint8_t *msg, int msg_len, int hash, r
 
 	return result;
 }
+
+#if CP_RSA == QUICK || !defined(STRIP)
+
+int cp_rsa_dec_batch(uint8_t *out[], int out_len[], uint8_t *in[],
+		int in_len[], int n, rsa_t prv) {
+	rsa_bat_t bat;
+
+	if (prv == NULL || n < 0) {
+		return STS_ERR;
+	}
+
+	bat.out = out;
+	bat.out_len = out_len;
+	bat.in = in;
+	bat.in_len = in_len;
+	bat.n = n;
+	bat.hash = 0;
+	bat.sig = 0;
+	return rsa_bat(&bat, prv);
+}
+
+int cp_rsa_sig_batch(uint8_t *sig[], int sig_len[], uint8_t *msg[],
+		int msg_len[], int n, int hash, rsa_t prv) {
+	rsa_bat_t bat;
+
+	if (prv == NULL || n < 0) {
+		return STS_ERR;
+	}
+
+	bat.out = sig;
+	bat.out_len = sig_len;
+	bat.in = msg;
+	bat.in_len = msg_len;
+	bat.n = n;
+	bat.hash = hash;
+	bat.sig = 1;
+	return rsa_bat(&bat, prv);
+}
+
+#endif
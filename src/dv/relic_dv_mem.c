@@ -102,4 +102,24 @@ void dv_free_statc(dv_t *a) {
 	(*a) = NULL;
 }
 
+#elif ALLOC == ARENA
+
+void dv_new_arena(dv_t *a, int digits) {
+	if (digits > DV_DIGS) {
+		THROW(ERR_NO_PRECI);
+	}
+
+	(*a) = arena_get(digits * (DIGIT / 8));
+	if ((*a) == NULL) {
+		THROW(ERR_NO_MEMORY);
+	}
+}
+
+void dv_free_arena(dv_t *a) {
+	if ((*a) != NULL) {
+		arena_put((*a));
+	}
+	(*a) = NULL;
+}
+
 #endif
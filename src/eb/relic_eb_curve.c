@@ -141,6 +141,38 @@ static void detect_opt(int *opt, fb_t a) {
 	}
 }
 
+#if defined(EB_PRECO)
+
+/**
+ * Precomputes the table for generator multiplication. A table referenced by
+ * other contexts is replaced by a new one owned by the current context.
+ *
+ * @throw ERR_NO_MEMORY if there is no available memory.
+ */
+static void compute_pre(void) {
+	ctx_t *ctx = core_get();
+	eb_tab_t *tab;
+
+	tab = (eb_tab_t *)core_tab_own(ctx->eb_tab, sizeof(eb_tab_t));
+	ctx->eb_tab = tab;
+	if (tab == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (int i = 0; i < EB_TABLE; i++) {
+		tab->eb_ptr[i] = &(tab->eb_pre[i]);
+#if ALLOC == STATIC
+		tab->eb_pre[i].x = tab->_eb_pre[3 * i];
+		tab->eb_pre[i].y = tab->_eb_pre[3 * i + 1];
+		tab->eb_pre[i].z = tab->_eb_pre[3 * i + 2];
+#endif
+	}
+	eb_mul_pre((eb_t *)eb_curve_get_tab(), &(ctx->eb_g));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -148,19 +180,12 @@ static void detect_opt(int *opt, fb_t a) {
 void eb_curve_init(void) {
 	ctx_t *ctx = core_get();
 #ifdef EB_PRECO
-	for (int i = 0; i < EB_TABLE; i++) {
-		ctx->eb_ptr[i] = &(ctx->eb_pre[i]);
-	}
+	ctx->eb_tab = NULL;
 #endif
 #if ALLOC == STATIC
 	fb_new(ctx->eb_g.x);
 	fb_new(ctx->eb_g.y);
 	fb_new(ctx->eb_g.z);
-	for (int i = 0; i < EB_TABLE; i++) {
-		fb_new(ctx->eb_pre[i].x);
-		fb_new(ctx->eb_pre[i].y);
-		fb_new(ctx->eb_pre[i].z);
-	}
 #endif
 	fb_zero(ctx->eb_g.x);
 	fb_zero(ctx->eb_g.y);
@@ -180,11 +205,10 @@ void eb_curve_clean(void) {
 	fb_free(ctx->eb_g.x);
 	fb_free(ctx->eb_g.y);
 	fb_free(ctx->eb_g.z);
-	for (int i = 0; i < EB_TABLE; i++) {
-		fb_free(ctx->eb_pre[i].x);
-		fb_free(ctx->eb_pre[i].y);
-		fb_free(ctx->eb_pre[i].z);
-	}
+#endif
+#ifdef EB_PRECO
+	core_tab_free(ctx->eb_tab);
+	ctx->eb_tab = NULL;
 #endif
 	bn_clean(&(ctx->eb_r));
 	bn_clean(&(ctx->eb_h));
@@ -256,11 +280,16 @@ void eb_curve_get_s1(bn_t s1) {
 const eb_t *eb_curve_get_tab() {
 #if defined(EB_PRECO)
 
+	eb_tab_t *tab = core_get()->eb_tab;
+
+	if (tab == NULL) {
+		return NULL;
+	}
 	/* Return a meaningful pointer. */
 #if ALLOC == AUTO
-	return (const eb_t *)*(core_get()->eb_ptr);
+	return (const eb_t *)*(tab->eb_ptr);
 #else
-	return (const eb_t *)core_get()->eb_ptr;
+	return (const eb_t *)tab->eb_ptr;
 #endif
 
 #else
@@ -292,6 +321,6 @@ void eb_curve_set(const fb_t a, const fb_t b, const eb_t g, const bn_t r,
 	bn_copy(&(ctx->eb_r), r);
 	bn_copy(&(ctx->eb_h), h);
 #if defined(EB_PRECO)
-	eb_mul_pre((eb_t *)eb_curve_get_tab(), &(ctx->eb_g));
+	compute_pre();
 #endif
 }
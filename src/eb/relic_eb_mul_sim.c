@@ -30,6 +30,8 @@
  * @ingroup eb
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 #include "relic_eb.h"
 #include "relic_util.h"
@@ -277,6 +279,303 @@ static void eb_mul_sim_plain(eb_t r, const eb_t p, const bn_t k, const eb_t q,
 
 #endif /* EB_SIM == INTER */
 
+/**
+ * Number of points below which simultaneous multiplication of many points
+ * uses interleaving instead of the bucket method.
+ */
+#define EB_LOT_INTER	32
+
+/**
+ * Maximum window width used in the bucket method.
+ */
+#define EB_LOT_WIDTH	13
+
+/**
+ * Multiplies and adds many binary elliptic curve points simultaneously by
+ * interleaving their w-NAF representations (Straus' method). At most
+ * EB_LOT_INTER points are supported.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void eb_mul_sim_lot_inter(eb_t r, const eb_t p[], const bn_t k[],
+		int n) {
+	int i, j, len, l[EB_LOT_INTER];
+	int8_t naf[EB_LOT_INTER][FB_BITS + 1], u;
+	eb_t t[EB_LOT_INTER][1 << (EB_WIDTH - 2)];
+	bn_t _k;
+
+	bn_null(_k);
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < (1 << (EB_WIDTH - 2)); j++) {
+			eb_null(t[i][j]);
+		}
+	}
+
+	TRY {
+		bn_new(_k);
+
+		len = 0;
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EB_WIDTH - 2)); j++) {
+				eb_new(t[i][j]);
+			}
+			eb_tab(t[i], p[i], EB_WIDTH);
+
+			bn_abs(_k, k[i]);
+			l[i] = FB_BITS + 1;
+			bn_rec_naf(naf[i], &l[i], _k, EB_WIDTH);
+			if (bn_sign(k[i]) == BN_NEG) {
+				for (j = 0; j < l[i]; j++) {
+					naf[i][j] = -naf[i][j];
+				}
+			}
+			len = MAX(len, l[i]);
+		}
+
+		eb_set_infty(r);
+		for (j = len - 1; j >= 0; j--) {
+			eb_dbl(r, r);
+			for (i = 0; i < n; i++) {
+				if (j >= l[i]) {
+					continue;
+				}
+				u = naf[i][j];
+				if (u > 0) {
+					eb_add(r, r, t[i][u / 2]);
+				}
+				if (u < 0) {
+					eb_sub(r, r, t[i][-u / 2]);
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		eb_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(_k);
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EB_WIDTH - 2)); j++) {
+				eb_free(t[i][j]);
+			}
+		}
+	}
+}
+
+#if defined(EB_KBLTZ)
+
+/**
+ * Multiplies and adds many binary elliptic curve points simultaneously by
+ * interleaving their w-TNAF representations on a Koblitz curve. At most
+ * EB_LOT_INTER points are supported.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void eb_mul_sim_lot_kbltz(eb_t r, const eb_t p[], const bn_t k[],
+		int n) {
+	int i, j, len, l[EB_LOT_INTER];
+	int8_t tnaf[EB_LOT_INTER][FB_BITS + 8], u, v;
+	eb_t t[EB_LOT_INTER][1 << (EB_WIDTH - 2)];
+	bn_t vm, s0, s1, _k;
+
+	bn_null(vm);
+	bn_null(s0);
+	bn_null(s1);
+	bn_null(_k);
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < (1 << (EB_WIDTH - 2)); j++) {
+			eb_null(t[i][j]);
+		}
+	}
+
+	TRY {
+		bn_new(vm);
+		bn_new(s0);
+		bn_new(s1);
+		bn_new(_k);
+
+		if (eb_curve_opt_a() == OPT_ZERO) {
+			u = -1;
+		} else {
+			u = 1;
+		}
+		eb_curve_get_vm(vm);
+		eb_curve_get_s0(s0);
+		eb_curve_get_s1(s1);
+
+		len = 0;
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EB_WIDTH - 2)); j++) {
+				eb_new(t[i][j]);
+				eb_set_infty(t[i][j]);
+				fb_set_bit(t[i][j]->z, 0, 1);
+				t[i][j]->norm = 1;
+			}
+			eb_tab(t[i], p[i], EB_WIDTH);
+
+			/* Compute the w-TNAF representation of k[i]. */
+			bn_abs(_k, k[i]);
+			l[i] = FB_BITS + 8;
+			bn_rec_tnaf(tnaf[i], &l[i], _k, vm, s0, s1, u, FB_BITS, EB_WIDTH);
+			if (bn_sign(k[i]) == BN_NEG) {
+				for (j = 0; j < l[i]; j++) {
+					tnaf[i][j] = -tnaf[i][j];
+				}
+			}
+			len = MAX(len, l[i]);
+		}
+
+		eb_set_infty(r);
+		for (j = len - 1; j >= 0; j--) {
+			eb_frb(r, r);
+			for (i = 0; i < n; i++) {
+				if (j >= l[i]) {
+					continue;
+				}
+				v = tnaf[i][j];
+				if (v > 0) {
+					eb_add(r, r, t[i][v / 2]);
+				}
+				if (v < 0) {
+					eb_sub(r, r, t[i][-v / 2]);
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		eb_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(vm);
+		bn_free(s0);
+		bn_free(s1);
+		bn_free(_k);
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EB_WIDTH - 2)); j++) {
+				eb_free(t[i][j]);
+			}
+		}
+	}
+}
+
+#endif /* EB_KBLTZ */
+
+/**
+ * Multiplies and adds many binary elliptic curve points simultaneously by
+ * accumulating them in buckets indexed by signed window digits (Pippenger's
+ * method).
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void eb_mul_sim_lot_bucket(eb_t r, const eb_t p[], const bn_t k[],
+		int n) {
+	int i, j, b, c, w, d, bits;
+	long long cost, min;
+	eb_t s, t, *u;
+
+	bits = 0;
+	for (i = 0; i < n; i++) {
+		bits = MAX(bits, bn_bits(k[i]));
+	}
+
+	/* Choose the window width minimizing the number of additions. */
+	c = 2;
+	min = (long long)(bits / c + 1) * (n + (1 << c));
+	for (w = 3; w <= EB_LOT_WIDTH; w++) {
+		cost = (long long)(bits / w + 1) * (n + (1 << w));
+		if (cost < min) {
+			min = cost;
+			c = w;
+		}
+	}
+
+	u = (eb_t *)malloc((1 << (c - 1)) * sizeof(eb_t));
+	if (u == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	eb_null(s);
+	eb_null(t);
+	for (i = 0; i < (1 << (c - 1)); i++) {
+		eb_null(u[i]);
+	}
+
+	TRY {
+		eb_new(s);
+		eb_new(t);
+		for (i = 0; i < (1 << (c - 1)); i++) {
+			eb_new(u[i]);
+		}
+
+		eb_set_infty(r);
+		for (j = bits / c; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				eb_dbl(r, r);
+			}
+			for (i = 0; i < (1 << (c - 1)); i++) {
+				eb_set_infty(u[i]);
+			}
+			for (i = 0; i < n; i++) {
+				/* Recode the window as a signed digit d, with |d| <= 2^(c-1). */
+				d = 0;
+				for (b = c - 1; b >= 0; b--) {
+					d = (d << 1) | bn_get_bit(k[i], j * c + b);
+				}
+				if (j > 0) {
+					d += bn_get_bit(k[i], j * c - 1);
+				}
+				d -= bn_get_bit(k[i], j * c + c - 1) << c;
+				if (bn_sign(k[i]) == BN_NEG) {
+					d = -d;
+				}
+				if (d > 0) {
+					eb_add(u[d - 1], u[d - 1], p[i]);
+				}
+				if (d < 0) {
+					eb_sub(u[-d - 1], u[-d - 1], p[i]);
+				}
+			}
+			/* Compute sum_i i * u[i - 1] with running sums. */
+			eb_set_infty(s);
+			eb_set_infty(t);
+			for (i = (1 << (c - 1)) - 1; i >= 0; i--) {
+				eb_add(s, s, u[i]);
+				eb_add(t, t, s);
+			}
+			eb_add(r, r, t);
+		}
+		/* Convert r to affine coordinates. */
+		eb_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		eb_free(s);
+		eb_free(t);
+		for (i = 0; i < (1 << (c - 1)); i++) {
+			eb_free(u[i]);
+		}
+		free(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -520,3 +819,44 @@ void eb_mul_sim_gen(eb_t r, const bn_t k, const eb_t q, const bn_t m) {
 		eb_free(g);
 	}
 }
+
+void eb_mul_sim_lot(eb_t r, const eb_t p[], const bn_t k[], int n) {
+	int i, bits = 0;
+
+	for (i = 0; i < n; i++) {
+		bits = MAX(bits, bn_bits(k[i]));
+	}
+
+#if defined(EB_KBLTZ)
+	if (eb_curve_is_kbltz() && bits <= FB_BITS) {
+		eb_t t;
+
+		eb_null(t);
+
+		TRY {
+			eb_new(t);
+
+			/* Process the points in chunks, so the tables stay bounded. */
+			eb_mul_sim_lot_kbltz(r, p, k, MIN(n, EB_LOT_INTER));
+			for (i = EB_LOT_INTER; i < n; i += EB_LOT_INTER) {
+				eb_mul_sim_lot_kbltz(t, p + i, k + i, MIN(n - i, EB_LOT_INTER));
+				eb_add(r, r, t);
+			}
+			eb_norm(r, r);
+		}
+		CATCH_ANY {
+			THROW(ERR_CAUGHT);
+		}
+		FINALLY {
+			eb_free(t);
+		}
+		return;
+	}
+#endif
+
+	if (n <= EB_LOT_INTER && bits <= FB_BITS) {
+		eb_mul_sim_lot_inter(r, p, k, n);
+	} else {
+		eb_mul_sim_lot_bucket(r, p, k, n);
+	}
+}
@@ -125,6 +125,7 @@ static void ep_add_basic_imp(ep_t r, fp_t s, const ep_t p, const ep_t q) {
  */
 static void ep_add_projc_mix(ep_t r, const ep_t p, const ep_t q) {
 	fp_t t0, t1, t2, t3, t4, t5, t6;
+	dv_t d;
 
 	fp_null(t0);
 	fp_null(t1);
@@ -133,6 +134,7 @@ static void ep_add_projc_mix(ep_t r, const ep_t p, const ep_t q) {
 	fp_null(t4);
 	fp_null(t5);
 	fp_null(t6);
+	dv_null(d);
 
 	TRY {
 		fp_new(t0);
@@ -142,6 +144,7 @@ static void ep_add_projc_mix(ep_t r, const ep_t p, const ep_t q) {
 		fp_new(t4);
 		fp_new(t5);
 		fp_new(t6);
+		dv_new(d);
 
 		/* madd-2007-bl formulas: 7M + 4S + 9add + 1*4 + 3*2. */
 		/* http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#addition-madd-2007-bl */
@@ -201,12 +204,12 @@ static void ep_add_projc_mix(ep_t r, const ep_t p, const ep_t q) {
 			fp_dbl(t6, t4);
 			fp_sub(r->x, r->x, t6);
 
-			/* y3 = R * (V - x3) - 2 * Y1 * J. */
+			/* y3 = R * (V - x3) - 2 * Y1 * J, with a single reduction. */
 			fp_sub(t4, t4, r->x);
-			fp_mul(t4, t4, t1);
-			fp_mul(t1, p->y, t5);
-			fp_dbl(t1, t1);
-			fp_sub(r->y, t4, t1);
+			fp_dbl(t6, p->y);
+			fp_mul_unr(d, t4, t1);
+			fp_mls_unr(d, t6, t5);
+			fp_rdc(r->y, d);
 
 			if (!p->norm) {
 				/* z3 = (z1 + H)^2 - z1^2 - HH. */
@@ -232,6 +235,7 @@ static void ep_add_projc_mix(ep_t r, const ep_t p, const ep_t q) {
 		fp_free(t4);
 		fp_free(t5);
 		fp_free(t6);
+		dv_free(d);
 	}
 }
 
@@ -258,6 +262,7 @@ static void ep_add_projc_imp(ep_t r, const ep_t p, const ep_t q) {
 #endif
 
 	fp_t t0, t1, t2, t3, t4, t5, t6;
+	dv_t d;
 
 	fp_null(t0);
 	fp_null(t1);
@@ -266,6 +271,7 @@ static void ep_add_projc_imp(ep_t r, const ep_t p, const ep_t q) {
 	fp_null(t4);
 	fp_null(t5);
 	fp_null(t6);
+	dv_null(d);
 
 	TRY {
 		fp_new(t0);
@@ -275,6 +281,7 @@ static void ep_add_projc_imp(ep_t r, const ep_t p, const ep_t q) {
 		fp_new(t4);
 		fp_new(t5);
 		fp_new(t6);
+		dv_new(d);
 
 		/* add-2007-bl formulas: 11M + 5S + 9add + 4*2 */
 		/* http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#addition-add-2007-bl */
@@ -335,12 +342,12 @@ static void ep_add_projc_imp(ep_t r, const ep_t p, const ep_t q) {
 			fp_dbl(t2, t4);
 			fp_sub(r->x, r->x, t2);
 
-			/* y3 = R * (V - x3) - 2 * S1 * J. */
+			/* y3 = R * (V - x3) - 2 * S1 * J, with a single reduction. */
 			fp_sub(t4, t4, r->x);
-			fp_mul(t4, t4, t0);
-			fp_mul(t1, t1, t5);
 			fp_dbl(t1, t1);
-			fp_sub(r->y, t4, t1);
+			fp_mul_unr(d, t4, t0);
+			fp_mls_unr(d, t1, t5);
+			fp_rdc(r->y, d);
 
 			/* z3 = ((z1 + z2)^2 - z1^2 - z2^2) * H. */
 			fp_add(r->z, p->z, q->z);
@@ -361,6 +368,7 @@ static void ep_add_projc_imp(ep_t r, const ep_t p, const ep_t q) {
 		fp_free(t4);
 		fp_free(t5);
 		fp_free(t6);
+		dv_free(d);
 	}
 #endif
 }
@@ -82,6 +82,38 @@ static void detect_opt(int *opt, fp_t a) {
 	}
 }
 
+#if defined(EP_PRECO)
+
+/**
+ * Precomputes the table for generator multiplication. A table referenced by
+ * other contexts is replaced by a new one owned by the current context.
+ *
+ * @throw ERR_NO_MEMORY if there is no available memory.
+ */
+static void compute_pre(void) {
+	ctx_t *ctx = core_get();
+	ep_tab_t *tab;
+
+	tab = (ep_tab_t *)core_tab_own(ctx->ep_tab, sizeof(ep_tab_t));
+	ctx->ep_tab = tab;
+	if (tab == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (int i = 0; i < EP_TABLE; i++) {
+		tab->ep_ptr[i] = &(tab->ep_pre[i]);
+#if ALLOC == STATIC
+		tab->ep_pre[i].x = tab->_ep_pre[3 * i];
+		tab->ep_pre[i].y = tab->_ep_pre[3 * i + 1];
+		tab->ep_pre[i].z = tab->_ep_pre[3 * i + 2];
+#endif
+	}
+	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -89,21 +121,12 @@ static void detect_opt(int *opt, fp_t a) {
 void ep_curve_init(void) {
 	ctx_t *ctx = core_get();
 #ifdef EP_PRECO
-	for (int i = 0; i < EP_TABLE; i++) {
-		ctx->ep_ptr[i] = &(ctx->ep_pre[i]);
-	}
+	ctx->ep_tab = NULL;
 #endif
 #if ALLOC == STATIC
 	fp_new(ctx->ep_g.x);
 	fp_new(ctx->ep_g.y);
 	fp_new(ctx->ep_g.z);
-#ifdef EP_PRECO
-	for (int i = 0; i < EP_TABLE; i++) {
-		fp_new(ctx->ep_pre[i].x);
-		fp_new(ctx->ep_pre[i].y);
-		fp_new(ctx->ep_pre[i].z);
-	}
-#endif
 #endif
 	ep_set_infty(&ctx->ep_g);
 	bn_init(&ctx->ep_r, FP_DIGS);
@@ -122,13 +145,10 @@ void ep_curve_clean(void) {
 	fp_free(ctx->ep_g.x);
 	fp_free(ctx->ep_g.y);
 	fp_free(ctx->ep_g.z);
-#ifdef EP_PRECO
-	for (int i = 0; i < EP_TABLE; i++) {
-		fp_free(ctx->ep_pre[i].x);
-		fp_free(ctx->ep_pre[i].y);
-		fp_free(ctx->ep_pre[i].z);
-	}
 #endif
+#ifdef EP_PRECO
+	core_tab_free(ctx->ep_tab);
+	ctx->ep_tab = NULL;
 #endif
 	bn_clean(&ctx->ep_r);
 	bn_clean(&ctx->ep_h);
@@ -201,11 +221,16 @@ void ep_curve_get_cof(bn_t h) {
 const ep_t *ep_curve_get_tab() {
 #if defined(EP_PRECO)
 
+	ep_tab_t *tab = core_get()->ep_tab;
+
+	if (tab == NULL) {
+		return NULL;
+	}
 	/* Return a meaningful pointer. */
 #if ALLOC == AUTO
-	return (const ep_t *)*core_get()->ep_ptr;
+	return (const ep_t *)*tab->ep_ptr;
 #else
-	return (const ep_t *)core_get()->ep_ptr;
+	return (const ep_t *)tab->ep_ptr;
 #endif
 
 #else
@@ -233,7 +258,7 @@ void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 	bn_copy(&(ctx->ep_h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	compute_pre();
 #endif
 }
 
@@ -258,7 +283,7 @@ void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 	bn_copy(&(ctx->ep_h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	compute_pre();
 #endif
 }
 
@@ -319,7 +344,7 @@ void ep_curve_set_endom(const fp_t b, const ep_t g, const bn_t r, const bn_t h,
 	bn_copy(&(ctx->ep_h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	compute_pre();
 #endif
 }
 
@@ -331,10 +331,6 @@ void ep_mul_slide(ep_t r, const ep_t p, const bn_t k) {
 		ep_copy(t[0], p);
 		ep_dbl(q, p);
 
-#if defined(EP_MIXED)
-		ep_norm(q, q);
-#endif
-
 		/* Create table. */
 		for (i = 1; i < (1 << (EP_WIDTH - 1)); i++) {
 			ep_add(t[i], t[i - 1], q);
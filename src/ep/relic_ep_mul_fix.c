@@ -479,9 +479,6 @@ void ep_mul_pre_combs(ep_t *t, const ep_t p) {
 			for (i = 1; i < l; i++) {
 				ep_dbl(t[1 << j], t[1 << j]);
 			}
-#if defined(EP_MIXED)
-			ep_norm(t[1 << j], t[1 << j]);
-#endif
 			for (i = 1; i < (1 << j); i++) {
 				ep_add(t[(1 << j) + i], t[i], t[1 << j]);
 			}
@@ -534,9 +531,6 @@ void ep_mul_pre_combd(ep_t *t, const ep_t p) {
 			for (i = 1; i < d; i++) {
 				ep_dbl(t[1 << j], t[1 << j]);
 			}
-#if defined(EP_MIXED)
-			ep_norm(t[1 << j], t[1 << j]);
-#endif
 			for (i = 1; i < (1 << j); i++) {
 				ep_add(t[(1 << j) + i], t[i], t[1 << j]);
 			}
@@ -549,9 +543,7 @@ void ep_mul_pre_combd(ep_t *t, const ep_t p) {
 			}
 		}
 
-		ep_norm_sim(t + 2, (const ep_t *)t + 2, (1 << EP_DEPTH) - 2);
-		ep_norm_sim(t + (1 << EP_DEPTH) + 1,
-				(const ep_t *)t + (1 << EP_DEPTH) + 1, (1 << EP_DEPTH) - 1);
+		ep_norm_sim(t + 2, (const ep_t *)t + 2, EP_TABLE_COMBD - 2);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
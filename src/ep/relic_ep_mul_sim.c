@@ -30,6 +30,8 @@
  * @ingroup ep
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 
 /*============================================================================*/
@@ -357,6 +359,199 @@ static void ep_mul_sim_plain(ep_t r, const ep_t p, const bn_t k, const ep_t q,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Number of points below which simultaneous multiplication of many points
+ * uses interleaving instead of the bucket method.
+ */
+#define EP_LOT_INTER	32
+
+/**
+ * Maximum window width used in the bucket method.
+ */
+#define EP_LOT_WIDTH	13
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously by
+ * interleaving their w-NAF representations (Straus' method). At most
+ * EP_LOT_INTER points are supported.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void ep_mul_sim_lot_inter(ep_t r, const ep_t p[], const bn_t k[],
+		int n) {
+	int i, j, len, l[EP_LOT_INTER];
+	int8_t naf[EP_LOT_INTER][FP_BITS + 1], u;
+	ep_t t[EP_LOT_INTER][1 << (EP_WIDTH - 2)];
+	bn_t _k;
+
+	bn_null(_k);
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+			ep_null(t[i][j]);
+		}
+	}
+
+	TRY {
+		bn_new(_k);
+
+		len = 0;
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep_new(t[i][j]);
+			}
+			ep_tab(t[i], p[i], EP_WIDTH);
+
+			bn_abs(_k, k[i]);
+			l[i] = FP_BITS + 1;
+			bn_rec_naf(naf[i], &l[i], _k, EP_WIDTH);
+			if (bn_sign(k[i]) == BN_NEG) {
+				for (j = 0; j < l[i]; j++) {
+					naf[i][j] = -naf[i][j];
+				}
+			}
+			len = MAX(len, l[i]);
+		}
+
+		ep_set_infty(r);
+		for (j = len - 1; j >= 0; j--) {
+			ep_dbl(r, r);
+			for (i = 0; i < n; i++) {
+				if (j >= l[i]) {
+					continue;
+				}
+				u = naf[i][j];
+				if (u > 0) {
+					ep_add(r, r, t[i][u / 2]);
+				}
+				if (u < 0) {
+					ep_sub(r, r, t[i][-u / 2]);
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(_k);
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep_free(t[i][j]);
+			}
+		}
+	}
+}
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously by
+ * accumulating them in buckets indexed by signed window digits (Pippenger's
+ * method).
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void ep_mul_sim_lot_bucket(ep_t r, const ep_t p[], const bn_t k[],
+		int n) {
+	int i, j, b, c, w, d, bits;
+	long long cost, min;
+	ep_t s, t, *u;
+
+	bits = 0;
+	for (i = 0; i < n; i++) {
+		bits = MAX(bits, bn_bits(k[i]));
+	}
+
+	/* Choose the window width minimizing the number of additions. */
+	c = 2;
+	min = (long long)(bits / c + 1) * (n + (1 << c));
+	for (w = 3; w <= EP_LOT_WIDTH; w++) {
+		cost = (long long)(bits / w + 1) * (n + (1 << w));
+		if (cost < min) {
+			min = cost;
+			c = w;
+		}
+	}
+
+	u = (ep_t *)malloc((1 << (c - 1)) * sizeof(ep_t));
+	if (u == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	ep_null(s);
+	ep_null(t);
+	for (i = 0; i < (1 << (c - 1)); i++) {
+		ep_null(u[i]);
+	}
+
+	TRY {
+		ep_new(s);
+		ep_new(t);
+		for (i = 0; i < (1 << (c - 1)); i++) {
+			ep_new(u[i]);
+		}
+
+		ep_set_infty(r);
+		for (j = bits / c; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep_dbl(r, r);
+			}
+			for (i = 0; i < (1 << (c - 1)); i++) {
+				ep_set_infty(u[i]);
+			}
+			for (i = 0; i < n; i++) {
+				/* Recode the window as a signed digit d, with |d| <= 2^(c-1). */
+				d = 0;
+				for (b = c - 1; b >= 0; b--) {
+					d = (d << 1) | bn_get_bit(k[i], j * c + b);
+				}
+				if (j > 0) {
+					d += bn_get_bit(k[i], j * c - 1);
+				}
+				d -= bn_get_bit(k[i], j * c + c - 1) << c;
+				if (bn_sign(k[i]) == BN_NEG) {
+					d = -d;
+				}
+				if (d > 0) {
+					ep_add(u[d - 1], u[d - 1], p[i]);
+				}
+				if (d < 0) {
+					ep_sub(u[-d - 1], u[-d - 1], p[i]);
+				}
+			}
+			/* Compute sum_i i * u[i - 1] with running sums. */
+			ep_set_infty(s);
+			ep_set_infty(t);
+			for (i = (1 << (c - 1)) - 1; i >= 0; i--) {
+				ep_add(s, s, u[i]);
+				ep_add(t, t, s);
+			}
+			ep_add(r, r, t);
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(s);
+		ep_free(t);
+		for (i = 0; i < (1 << (c - 1)); i++) {
+			ep_free(u[i]);
+		}
+		free(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -600,3 +795,17 @@ void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m) {
 		ep_free(g);
 	}
 }
+
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int i, bits = 0;
+
+	for (i = 0; i < n; i++) {
+		bits = MAX(bits, bn_bits(k[i]));
+	}
+
+	if (n <= EP_LOT_INTER && bits <= FP_BITS) {
+		ep_mul_sim_lot_inter(r, p, k, n);
+	} else {
+		ep_mul_sim_lot_bucket(r, p, k, n);
+	}
+}
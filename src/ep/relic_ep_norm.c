@@ -104,6 +104,10 @@ void ep_norm_sim(ep_t *r, const ep_t *t, int n) {
 	int i;
 	fp_t a[n];
 
+	if (n == 0) {
+		return;
+	}
+
 	for (i = 0; i < n; i++) {
 		fp_null(a[i]);
 	}
@@ -111,19 +115,27 @@ void ep_norm_sim(ep_t *r, const ep_t *t, int n) {
 	TRY {
 		for (i = 0; i < n; i++) {
 			fp_new(a[i]);
-			fp_copy(a[i], t[i]->z);
+			/* Points at infinity or in affine coordinates do not need z^-1. */
+			if (ep_is_infty(t[i]) || t[i]->norm) {
+				fp_set_dig(a[i], 1);
+			} else {
+				fp_copy(a[i], t[i]->z);
+			}
 		}
 
 		fp_inv_sim(a, (const fp_t *)a, n);
 
 		for (i = 0; i < n; i++) {
-			fp_copy(r[i]->x, t[i]->x);
-			fp_copy(r[i]->y, t[i]->y);
-			fp_copy(r[i]->z, a[i]);
-		}
-
-		for (i = 0; i < n; i++) {
-			ep_norm_imp(r[i], r[i], 1);
+			if (ep_is_infty(t[i])) {
+				ep_set_infty(r[i]);
+			} else if (t[i]->norm) {
+				ep_copy(r[i], t[i]);
+			} else {
+				fp_copy(r[i]->x, t[i]->x);
+				fp_copy(r[i]->y, t[i]->y);
+				fp_copy(r[i]->z, a[i]);
+				ep_norm_imp(r[i], r[i], 1);
+			}
 		}
 	}
 	CATCH_ANY {
@@ -179,9 +179,6 @@ int ep_is_valid(const ep_t p) {
 void ep_tab(ep_t *t, const ep_t p, int w) {
 	if (w > 2) {
 		ep_dbl(t[0], p);
-#if defined(EP_MIXED)
-		ep_norm(t[0], t[0]);
-#endif
 		ep_add(t[1], t[0], p);
 		for (int i = 2; i < (1 << (w - 2)); i++) {
 			ep_add(t[i], t[i - 1], t[0]);
@@ -146,6 +146,41 @@
 	FETCH(str, CURVE##_R, sizeof(CURVE##_R));								\
 	bn_read_str(r, str, strlen(str), 16);									\
 
+#if defined(EP_PRECO)
+
+/**
+ * Precomputes the table for generator multiplication. A table referenced by
+ * other contexts is replaced by a new one owned by the current context.
+ *
+ * @throw ERR_NO_MEMORY if there is no available memory.
+ */
+static void compute_pre(void) {
+	ctx_t *ctx = core_get();
+	ep2_tab_t *tab;
+
+	tab = (ep2_tab_t *)core_tab_own(ctx->ep2_tab, sizeof(ep2_tab_t));
+	ctx->ep2_tab = tab;
+	if (tab == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (int i = 0; i < EP_TABLE; i++) {
+		tab->ep2_ptr[i] = &(tab->ep2_pre[i]);
+#if ALLOC != AUTO
+		tab->ep2_pre[i].x[0] = tab->_ep2_pre[3 * i][0];
+		tab->ep2_pre[i].x[1] = tab->_ep2_pre[3 * i][1];
+		tab->ep2_pre[i].y[0] = tab->_ep2_pre[3 * i + 1][0];
+		tab->ep2_pre[i].y[1] = tab->_ep2_pre[3 * i + 1][1];
+		tab->ep2_pre[i].z[0] = tab->_ep2_pre[3 * i + 2][0];
+		tab->ep2_pre[i].z[1] = tab->_ep2_pre[3 * i + 2][1];
+#endif
+	}
+	ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -154,12 +189,10 @@ void ep2_curve_init(void) {
 	ctx_t *ctx = core_get();
 
 #ifdef EP_PRECO
-	for (int i = 0; i < EP_TABLE; i++) {
-		ctx->ep2_ptr[i] = &(ctx->ep2_pre[i]);
-	}
+	ctx->ep2_tab = NULL;
 #endif
 
-#if ALLOC == STATIC || ALLOC == DYNAMIC || ALLOC == STACK
+#if ALLOC == STATIC || ALLOC == DYNAMIC || ALLOC == STACK || ALLOC == ARENA
 	ctx->ep2_g.x[0] = ctx->ep2_gx[0];
 	ctx->ep2_g.x[1] = ctx->ep2_gx[1];
 	ctx->ep2_g.y[0] = ctx->ep2_gy[0];
@@ -168,24 +201,6 @@ void ep2_curve_init(void) {
 	ctx->ep2_g.z[1] = ctx->ep2_gz[1];
 #endif
 
-#ifdef EP_PRECO
-#if ALLOC == STATIC || ALLOC == DYNAMIC
-	for (int i = 0; i < EP_TABLE; i++) {
-		fp2_new(ctx->ep2_pre[i].x);
-		fp2_new(ctx->ep2_pre[i].y);
-		fp2_new(ctx->ep2_pre[i].z);
-	}
-#elif ALLOC == STACK
-	for (int i = 0; i < EP_TABLE; i++) {
-		ctx->ep2_pre[i].x[0] = ctx->_ep2_pre[3 * i][0];
-		ctx->ep2_pre[i].x[1] = ctx->_ep2_pre[3 * i][1];
-		ctx->ep2_pre[i].y[0] = ctx->_ep2_pre[3 * i + 1][0];
-		ctx->ep2_pre[i].y[1] = ctx->_ep2_pre[3 * i + 1][1];
-		ctx->ep2_pre[i].z[0] = ctx->_ep2_pre[3 * i + 2][0];
-		ctx->ep2_pre[i].z[1] = ctx->_ep2_pre[3 * i + 2][1];
-	}
-#endif
-#endif
 	ep2_set_infty(&(ctx->ep2_g));
 	bn_init(&(ctx->ep2_r), FP_DIGS);
 	bn_init(&(ctx->ep2_h), FP_DIGS);
@@ -194,11 +209,8 @@ void ep2_curve_init(void) {
 void ep2_curve_clean(void) {
 	ctx_t *ctx = core_get();
 #ifdef EP_PRECO
-	for (int i = 0; i < EP_TABLE; i++) {
-		fp2_free(ctx->ep2_pre[i].x);
-		fp2_free(ctx->ep2_pre[i].y);
-		fp2_free(ctx->ep2_pre[i].z);
-	}
+	core_tab_free(ctx->ep2_tab);
+	ctx->ep2_tab = NULL;
 #endif
 	bn_clean(&(ctx->ep2_r));
 	bn_clean(&(ctx->ep2_h));
@@ -240,10 +252,15 @@ void ep2_curve_get_cof(bn_t h) {
 #if defined(EP_PRECO)
 
 ep2_t *ep2_curve_get_tab() {
+	ep2_tab_t *tab = core_get()->ep2_tab;
+
+	if (tab == NULL) {
+		return NULL;
+	}
 #if ALLOC == AUTO
-	return (ep2_t *)*(core_get()->ep2_ptr);
+	return (ep2_t *)*(tab->ep2_ptr);
 #else
-	return core_get()->ep2_ptr;
+	return tab->ep2_ptr;
 #endif
 }
 
@@ -317,7 +334,7 @@ void ep2_curve_set_twist(int type) {
 		fp_prime_calc();
 
 #if defined(EP_PRECO)
-		ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
+		compute_pre();
 #endif
 	}
 	CATCH_ANY {
@@ -343,6 +360,6 @@ void ep2_curve_set(fp2_t a, fp2_t b, ep2_t g, bn_t r, bn_t h) {
 	bn_copy(&(ctx->ep2_h), h);
 
 #if defined(EP_PRECO)
-	ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
+	compute_pre();
 #endif
 }
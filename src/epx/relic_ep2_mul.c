@@ -32,25 +32,331 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if EP_MUL == LWNAF || !defined(STRIP)
+
+/**
+ * Short vectors of the lattice used to decompose scalars for the GLS method,
+ * given as pairs (c0, c1) representing c0 + c1 * u for the curve parameter u.
+ * The first set is for BN curves and the second one for BLS12 curves.
+ */
+static const int gls_basis[2][4][4][2] = {
+	{
+		{{1, 1}, {0, 1}, {0, 1}, {0, -2}},
+		{{1, 2}, {0, -1}, {-1, -1}, {0, -1}},
+		{{0, 2}, {1, 2}, {1, 2}, {1, 2}},
+		{{-1, 1}, {2, 4}, {1, -2}, {-1, 1}}
+	},
+	{
+		{{0, 1}, {-1, 0}, {0, 0}, {0, 0}},
+		{{0, 0}, {0, 1}, {-1, 0}, {0, 0}},
+		{{0, 0}, {0, 0}, {0, 1}, {-1, 0}},
+		{{1, 0}, {0, 0}, {-1, 0}, {0, 1}}
+	}
+};
+
+/**
+ * Coefficients in u of the polynomials used to round the scalar decomposition.
+ */
+static const int gls_round[2][4][4] = {
+	{{1, 3, 2, 0}, {0, 1, 8, 12}, {0, 1, 4, 6}, {0, -1, -2, 0}},
+	{{0, -1, 0, 1}, {-1, 0, 1, 0}, {0, 1, 0, 0}, {1, 0, 0, 0}}
+};
+
+/**
+ * Returns the family of the current pairing-friendly curve for the GLS method.
+ *
+ * @return 0 for BN curves, 1 for BLS12 curves and -1 otherwise.
+ */
+static int ep2_gls_fam(void) {
+	if (!ep2_curve_is_twist()) {
+		return -1;
+	}
+	switch (fp_param_get()) {
+		case BN_158:
+		case BN_254:
+		case BN_256:
+		case BN_638:
+			return 0;
+		case B12_638:
+			return 1;
+		default:
+			return -1;
+	}
+}
+
+/**
+ * Adds a small signed integer multiple of a multiple-precision integer.
+ * Computes c = c + (d * a).
+ *
+ * @param[in,out] c			- the result.
+ * @param[in] a				- the multiple-precision integer.
+ * @param[in] d				- the small integer.
+ * @param[in] t				- a temporary integer.
+ */
+static void ep2_gls_add(bn_t c, bn_t a, int d, bn_t t) {
+	bn_mul_dig(t, a, (dig_t)(d < 0 ? -d : d));
+	if (d < 0) {
+		bn_sub(c, c, t);
+	} else {
+		bn_add(c, c, t);
+	}
+}
+
+/**
+ * Decomposes a scalar into four mini-scalars such that the sum of v[i] * p^i
+ * is congruent to k modulo the group order.
+ *
+ * @param[out] v			- the mini-scalars.
+ * @param[in] k				- the scalar, reduced modulo the order.
+ * @param[in] n				- the group order.
+ * @param[in] fam			- the family of the curve.
+ */
+static void ep2_gls_rec(bn_t *v, bn_t k, bn_t n, int fam) {
+	int i, j, d;
+	bn_t u[4], a, c, h, t;
+
+	bn_null(a);
+	bn_null(c);
+	bn_null(h);
+	bn_null(t);
+
+	TRY {
+		bn_new(a);
+		bn_new(c);
+		bn_new(h);
+		bn_new(t);
+		for (i = 0; i < 4; i++) {
+			bn_null(u[i]);
+			bn_new(u[i]);
+		}
+
+		/* Compute the powers of the curve parameter. */
+		bn_set_dig(u[0], 1);
+		fp_param_get_var(u[1]);
+		bn_mul(u[2], u[1], u[1]);
+		bn_mul(u[3], u[2], u[1]);
+		bn_hlv(h, n);
+
+		bn_copy(v[0], k);
+		for (i = 1; i < 4; i++) {
+			bn_zero(v[i]);
+		}
+		for (j = 0; j < 4; j++) {
+			/* Compute a_j = round(k * c_j(u) / n). */
+			bn_zero(c);
+			for (d = 0; d < 4; d++) {
+				ep2_gls_add(c, u[d], gls_round[fam][j][d], t);
+			}
+			bn_mul(a, k, c);
+			d = bn_sign(a);
+			bn_abs(a, a);
+			bn_add(a, a, h);
+			bn_div(a, a, n);
+			if (d == BN_NEG) {
+				bn_neg(a, a);
+			}
+			/* Subtract a_j times the j-th vector of the basis. */
+			for (i = 0; i < 4; i++) {
+				bn_zero(c);
+				ep2_gls_add(c, u[0], gls_basis[fam][j][i][0], t);
+				ep2_gls_add(c, u[1], gls_basis[fam][j][i][1], t);
+				bn_mul(c, c, a);
+				bn_sub(v[i], v[i], c);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a);
+		bn_free(c);
+		bn_free(h);
+		bn_free(t);
+		for (i = 0; i < 4; i++) {
+			bn_free(u[i]);
+		}
+	}
+}
+
+/**
+ * Multiplies a point in G_2 by an integer using the GLS method, with the
+ * Frobenius endomorphism acting as multiplication by p.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer, reduced modulo the order.
+ * @param[in] fam			- the family of the curve.
+ */
+static void ep2_mul_gls_imp(ep2_t r, ep2_t p, bn_t k, int fam) {
+	int i, j, l, m, s[4], len[4];
+	int8_t naf[4][FP_BITS + 1];
+	bn_t n, v[4];
+	ep2_t q, t[4][1 << (EP_WIDTH - 2)];
+
+	bn_null(n);
+	ep2_null(q);
+
+	TRY {
+		bn_new(n);
+		ep2_new(q);
+		for (i = 0; i < 4; i++) {
+			bn_null(v[i]);
+			bn_new(v[i]);
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_null(t[i][j]);
+				ep2_new(t[i][j]);
+			}
+		}
+
+		ep2_curve_get_ord(n);
+		ep2_gls_rec(v, k, n, fam);
+
+		/* Compute the tables for p and its images under the Frobenius. */
+		ep2_norm(q, p);
+		ep2_tab(t[0], q, EP_WIDTH);
+		for (i = 1; i < 4; i++) {
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_frb(t[i][j], t[i - 1][j], 1);
+				/* Keep z = 1 reduced, since fp_neg(0) returns p. */
+				if (t[i - 1][j]->norm) {
+					fp2_copy(t[i][j]->z, t[i - 1][j]->z);
+				} else {
+					fp2_frb(t[i][j]->z, t[i - 1][j]->z, 1);
+				}
+				t[i][j]->norm = t[i - 1][j]->norm;
+			}
+		}
+
+		l = 0;
+		for (i = 0; i < 4; i++) {
+			s[i] = bn_sign(v[i]);
+			bn_abs(v[i], v[i]);
+			len[i] = FP_BITS + 1;
+			bn_rec_naf(naf[i], &len[i], v[i], EP_WIDTH);
+			l = MAX(l, len[i]);
+		}
+		for (i = 0; i < 4; i++) {
+			for (j = len[i]; j < l; j++) {
+				naf[i][j] = 0;
+			}
+		}
+
+		ep2_set_infty(r);
+		for (j = l - 1; j >= 0; j--) {
+			ep2_dbl(r, r);
+
+			for (i = 0; i < 4; i++) {
+				m = (s[i] == BN_POS ? naf[i][j] : -naf[i][j]);
+				if (m > 0) {
+					ep2_add(r, r, t[i][m / 2]);
+				}
+				if (m < 0) {
+					ep2_sub(r, r, t[i][-m / 2]);
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		ep2_free(q);
+		for (i = 0; i < 4; i++) {
+			bn_free(v[i]);
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_free(t[i][j]);
+			}
+		}
+	}
+}
+
+/**
+ * Multiplies a point in an elliptic curve over a quadratic extension by an
+ * integer using the w-NAF method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+static void ep2_mul_naf_imp(ep2_t r, ep2_t p, bn_t k) {
+	int l, i, n;
+	int8_t naf[2 * FP_BITS + 1], *_k;
+	ep2_t t[1 << (EP_WIDTH - 2)];
+
+	for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+		ep2_null(t[i]);
+	}
+
+	TRY {
+		/* Prepare the precomputation table. */
+		for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+			ep2_new(t[i]);
+		}
+		/* Compute the precomputation table. */
+		ep2_tab(t, p, EP_WIDTH);
+
+		/* Compute the w-NAF representation of k. */
+		l = 2 * FP_BITS + 1;
+		bn_rec_naf(naf, &l, k, EP_WIDTH);
+
+		_k = naf + l - 1;
+
+		ep2_set_infty(r);
+		for (i = l - 1; i >= 0; i--, _k--) {
+			ep2_dbl(r, r);
+
+			n = *_k;
+			if (n > 0) {
+				ep2_add(r, r, t[n / 2]);
+			}
+			if (n < 0) {
+				ep2_sub(r, r, t[-n / 2]);
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		/* Free the precomputation table. */
+		for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+			ep2_free(t[i]);
+		}
+	}
+}
+
+#endif /* EP_MUL == LWNAF */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-void ep2_mul(ep2_t r, ep2_t p, bn_t k) {
+void ep2_mul_basic(ep2_t r, ep2_t p, bn_t k) {
 	int i, l;
 	ep2_t t;
 
 	ep2_null(t);
+
+	if (bn_is_zero(k)) {
+		ep2_set_infty(r);
+		return;
+	}
+
 	TRY {
 		ep2_new(t);
 		l = bn_bits(k);
 
-		if (bn_get_bit(k, l - 1)) {
-			ep2_copy(t, p);
-		} else {
-			ep2_set_infty(t);
-		}
-
+		ep2_copy(t, p);
 		for (i = l - 2; i >= 0; i--) {
 			ep2_dbl(t, t);
 			if (bn_get_bit(k, i)) {
@@ -58,8 +364,7 @@ void ep2_mul(ep2_t r, ep2_t p, bn_t k) {
 			}
 		}
 
-		ep2_copy(r, t);
-		ep2_norm(r, r);
+		ep2_norm(r, t);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -69,6 +374,290 @@ void ep2_mul(ep2_t r, ep2_t p, bn_t k) {
 	}
 }
 
+#if EP_MUL == SLIDE || !defined(STRIP)
+
+void ep2_mul_slide(ep2_t r, ep2_t p, bn_t k) {
+	ep2_t t[1 << (EP_WIDTH - 1)], q;
+	int i, j, l;
+	uint8_t win[2 * FP_BITS + 1];
+
+	ep2_null(q);
+
+	/* Initialize table. */
+	for (i = 0; i < (1 << (EP_WIDTH - 1)); i++) {
+		ep2_null(t[i]);
+	}
+
+	if (bn_is_zero(k)) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	TRY {
+		for (i = 0; i < (1 << (EP_WIDTH - 1)); i++) {
+			ep2_new(t[i]);
+		}
+
+		ep2_new(q);
+
+		ep2_copy(t[0], p);
+		ep2_dbl(q, p);
+
+		/* Create table. */
+		for (i = 1; i < (1 << (EP_WIDTH - 1)); i++) {
+			ep2_add(t[i], t[i - 1], q);
+		}
+
+#if defined(EP_MIXED)
+		ep2_norm_sim(t + 1, t + 1, (1 << (EP_WIDTH - 1)) - 1);
+#endif
+
+		ep2_set_infty(q);
+		l = 2 * FP_BITS + 1;
+		bn_rec_slw(win, &l, k, EP_WIDTH);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				ep2_dbl(q, q);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					ep2_dbl(q, q);
+				}
+				ep2_add(q, q, t[win[i] >> 1]);
+			}
+		}
+
+		ep2_norm(r, q);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < (1 << (EP_WIDTH - 1)); i++) {
+			ep2_free(t[i]);
+		}
+		ep2_free(q);
+	}
+}
+
+#endif
+
+#if EP_MUL == MONTY || !defined(STRIP)
+
+void ep2_mul_monty(ep2_t r, ep2_t p, bn_t k) {
+	ep2_t t[2];
+
+	ep2_null(t[0]);
+	ep2_null(t[1]);
+
+	if (bn_is_zero(k)) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	TRY {
+		ep2_new(t[0]);
+		ep2_new(t[1]);
+
+		ep2_set_infty(t[0]);
+		ep2_copy(t[1], p);
+
+		for (int i = bn_bits(k) - 1; i >= 0; i--) {
+			int j = bn_get_bit(k, i);
+			dv_swap_cond(t[0]->x[0], t[1]->x[0], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->x[1], t[1]->x[1], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->y[0], t[1]->y[0], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->y[1], t[1]->y[1], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->z[0], t[1]->z[0], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->z[1], t[1]->z[1], FP_DIGS, j ^ 1);
+			ep2_add(t[0], t[0], t[1]);
+			ep2_dbl(t[1], t[1]);
+			dv_swap_cond(t[0]->x[0], t[1]->x[0], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->x[1], t[1]->x[1], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->y[0], t[1]->y[0], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->y[1], t[1]->y[1], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->z[0], t[1]->z[0], FP_DIGS, j ^ 1);
+			dv_swap_cond(t[0]->z[1], t[1]->z[1], FP_DIGS, j ^ 1);
+		}
+
+		ep2_norm(r, t[0]);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep2_free(t[1]);
+		ep2_free(t[0]);
+	}
+}
+
+#endif
+
+#if EP_MUL == LWNAF || !defined(STRIP)
+
+void ep2_mul_lwnaf(ep2_t r, ep2_t p, bn_t k) {
+	bn_t _k, n;
+	int fam;
+
+	if (bn_is_zero(k)) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	fam = ep2_gls_fam();
+	if (fam == -1) {
+		ep2_mul_naf_imp(r, p, k);
+		return;
+	}
+
+	bn_null(_k);
+	bn_null(n);
+
+	TRY {
+		bn_new(_k);
+		bn_new(n);
+
+		ep2_curve_get_ord(n);
+		bn_abs(_k, k);
+		bn_mod(_k, _k, n);
+		ep2_mul_gls_imp(r, p, _k, fam);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(_k);
+		bn_free(n);
+	}
+}
+
+#endif
+
+#if EP_MUL == LWREG || !defined(STRIP)
+
+/**
+ * Reads a point from a precomputation table without branching on the digit or
+ * making memory accesses that depend on it. Computes r = sign(d) * t[|d|/2].
+ *
+ * @param[out] r			- the point read.
+ * @param[in] t				- the precomputation table.
+ * @param[in] d				- the odd digit.
+ * @param[in] n				- the number of points in the table.
+ */
+static void ep2_tab_get(ep2_t r, ep2_t *t, int d, int n) {
+	int s = d >> (8 * sizeof(int) - 1), a = ((d ^ s) - s) >> 1;
+	fp2_t y;
+	dig_t c;
+
+	fp2_null(y);
+
+	TRY {
+		fp2_new(y);
+
+		for (int i = 0; i < n; i++) {
+			c = (dig_t)(i ^ a);
+			c = ((c | -c) >> (FP_DIGIT - 1)) ^ 1;
+			dv_copy_cond(r->x[0], t[i]->x[0], FP_DIGS, c);
+			dv_copy_cond(r->x[1], t[i]->x[1], FP_DIGS, c);
+			dv_copy_cond(r->y[0], t[i]->y[0], FP_DIGS, c);
+			dv_copy_cond(r->y[1], t[i]->y[1], FP_DIGS, c);
+			dv_copy_cond(r->z[0], t[i]->z[0], FP_DIGS, c);
+			dv_copy_cond(r->z[1], t[i]->z[1], FP_DIGS, c);
+			r->norm ^= (r->norm ^ t[i]->norm) & -(int)c;
+		}
+		/* Negate the point if the digit is negative. */
+		fp_neg(y[0], r->y[0]);
+		fp_neg(y[1], r->y[1]);
+		dv_copy_cond(r->y[0], y[0], FP_DIGS, s & 1);
+		dv_copy_cond(r->y[1], y[1], FP_DIGS, s & 1);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(y);
+	}
+}
+
+void ep2_mul_lwreg(ep2_t r, ep2_t p, bn_t k) {
+	int i, j, l, m;
+	int8_t reg[CEIL(FP_BITS + 1, EP_WIDTH - 1) + 1], *_r;
+	bn_t _k, n;
+	ep2_t q, u, t[1 << (EP_WIDTH - 2)];
+
+	bn_null(_k);
+	bn_null(n);
+	ep2_null(q);
+	ep2_null(u);
+
+	for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+		ep2_null(t[i]);
+	}
+
+	TRY {
+		bn_new(_k);
+		bn_new(n);
+		ep2_new(q);
+		ep2_new(u);
+		for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+			ep2_new(t[i]);
+		}
+
+		ep2_curve_get_ord(n);
+		bn_abs(_k, k);
+		bn_mod(_k, _k, n);
+		if (bn_is_zero(_k)) {
+			ep2_set_infty(r);
+		} else {
+			/* The regular recoding requires an odd scalar, so compute
+			 * (k + 1)P - P when k is even. */
+			j = bn_is_even(_k);
+			bn_add_dig(_k, _k, j);
+
+			ep2_norm(q, p);
+			ep2_tab(t, q, EP_WIDTH);
+
+			l = CEIL(FP_BITS + 1, EP_WIDTH - 1) + 1;
+			bn_rec_reg(reg, &l, _k, FP_BITS, EP_WIDTH);
+
+			/* Every digit is odd, so the same operations run for any k. */
+			_r = reg + l - 1;
+			ep2_tab_get(r, t, *_r, 1 << (EP_WIDTH - 2));
+			for (i = l - 2, _r--; i >= 0; i--, _r--) {
+				for (m = 0; m < EP_WIDTH - 1; m++) {
+					ep2_dbl(r, r);
+				}
+				ep2_tab_get(u, t, *_r, 1 << (EP_WIDTH - 2));
+				ep2_add(r, r, u);
+			}
+
+			/* Subtract p if k was even, without branching on it. */
+			ep2_sub(q, r, q);
+			ep2_norm(r, r);
+			ep2_norm(q, q);
+			dv_copy_cond(r->x[0], q->x[0], FP_DIGS, j);
+			dv_copy_cond(r->x[1], q->x[1], FP_DIGS, j);
+			dv_copy_cond(r->y[0], q->y[0], FP_DIGS, j);
+			dv_copy_cond(r->y[1], q->y[1], FP_DIGS, j);
+			dv_copy_cond(r->z[0], q->z[0], FP_DIGS, j);
+			dv_copy_cond(r->z[1], q->z[1], FP_DIGS, j);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(_k);
+		bn_free(n);
+		ep2_free(q);
+		ep2_free(u);
+		for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+			ep2_free(t[i]);
+		}
+	}
+}
+
+#endif
+
 void ep2_mul_gen(ep2_t r, bn_t k) {
 #ifdef EP_PRECO
 	ep2_mul_fix(r, ep2_curve_get_tab(), k);
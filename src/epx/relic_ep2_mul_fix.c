@@ -48,9 +48,6 @@ static void ep2_mul_pre_ordin(ep2_t *t, ep2_t p) {
 	int i;
 
 	ep2_dbl(t[0], p);
-#if defined(EP_MIXED)
-	ep2_norm(t[0], t[0]);
-#endif
 
 #if EP_DEPTH > 2
 	ep2_add(t[1], t[0], p);
@@ -59,9 +56,7 @@ static void ep2_mul_pre_ordin(ep2_t *t, ep2_t p) {
 	}
 
 #if defined(EP_MIXED)
-	for (i = 1; i < (1 << (EP_DEPTH - 2)); i++) {
-		ep2_norm(t[i], t[i]);
-	}
+	ep2_norm_sim(t + 1, t + 1, (1 << (EP_DEPTH - 2)) - 1);
 #endif
 
 #endif
@@ -123,6 +118,8 @@ void ep2_mul_pre_basic(ep2_t *t, ep2_t p) {
 		for (int i = 1; i < bn_bits(n); i++) {
 			ep2_dbl(t[i], t[i - 1]);
 		}
+
+		ep2_norm_sim(t + 1, t + 1, bn_bits(n) - 1);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -236,6 +233,8 @@ void ep2_mul_pre_nafwi(ep2_t *t, ep2_t p) {
 				ep2_dbl(t[i], t[i]);
 			}
 		}
+
+		ep2_norm_sim(t + 1, t + 1, l - 1);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -327,17 +326,12 @@ void ep2_mul_pre_combs(ep2_t *t, ep2_t p) {
 			for (i = 1; i < l; i++) {
 				ep2_dbl(t[1 << j], t[1 << j]);
 			}
-#if defined(EP_MIXED)
-			ep2_norm(t[1 << j], t[1 << j]);
-#endif
 			for (i = 1; i < (1 << j); i++) {
 				ep2_add(t[(1 << j) + i], t[i], t[1 << j]);
 			}
 		}
 #if defined(EP_MIXED)
-		for (i = 1; i < EP_TABLE_COMBS; i++) {
-			ep2_norm(t[i], t[i]);
-		}
+		ep2_norm_sim(t + 1, t + 1, EP_TABLE_COMBS - 1);
 #endif
 	}
 	CATCH_ANY {
@@ -425,9 +419,6 @@ void ep2_mul_pre_combd(ep2_t *t, ep2_t p) {
 			for (i = 1; i < d; i++) {
 				ep2_dbl(t[1 << j], t[1 << j]);
 			}
-#if defined(EP_MIXED)
-			ep2_norm(t[1 << j], t[1 << j]);
-#endif
 			for (i = 1; i < (1 << j); i++) {
 				ep2_add(t[(1 << j) + i], t[i], t[1 << j]);
 			}
@@ -440,9 +431,7 @@ void ep2_mul_pre_combd(ep2_t *t, ep2_t p) {
 			}
 		}
 #if defined(EP_MIXED)
-		for (i = 1; i < EP_TABLE_COMBD; i++) {
-			ep2_norm(t[i], t[i]);
-		}
+		ep2_norm_sim(t + 1, t + 1, EP_TABLE_COMBD - 1);
 #endif
 	}
 	CATCH_ANY {
@@ -30,6 +30,8 @@
  * @ingroup epx
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 
 /*============================================================================*/
@@ -126,6 +128,197 @@ static void ep2_mul_sim_plain(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t l,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Number of points below which simultaneous multiplication of many points
+ * uses interleaving instead of the bucket method.
+ */
+#define EP2_LOT_INTER	32
+
+/**
+ * Maximum window width used in the bucket method.
+ */
+#define EP2_LOT_WIDTH	13
+
+/**
+ * Multiplies and adds many prime elliptic curve points over quadratic
+ * extensions simultaneously by interleaving their w-NAF representations
+ * (Straus' method). At most EP2_LOT_INTER points are supported.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void ep2_mul_sim_lot_inter(ep2_t r, ep2_t p[], bn_t k[], int n) {
+	int i, j, len, l[EP2_LOT_INTER];
+	int8_t naf[EP2_LOT_INTER][2 * FP_BITS + 1], u;
+	ep2_t t[EP2_LOT_INTER][1 << (EP_WIDTH - 2)];
+	bn_t _k;
+
+	bn_null(_k);
+
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+			ep2_null(t[i][j]);
+		}
+	}
+
+	TRY {
+		bn_new(_k);
+
+		len = 0;
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_new(t[i][j]);
+			}
+			ep2_tab(t[i], p[i], EP_WIDTH);
+
+			bn_abs(_k, k[i]);
+			l[i] = 2 * FP_BITS + 1;
+			bn_rec_naf(naf[i], &l[i], _k, EP_WIDTH);
+			if (bn_sign(k[i]) == BN_NEG) {
+				for (j = 0; j < l[i]; j++) {
+					naf[i][j] = -naf[i][j];
+				}
+			}
+			len = MAX(len, l[i]);
+		}
+
+		ep2_set_infty(r);
+		for (j = len - 1; j >= 0; j--) {
+			ep2_dbl(r, r);
+			for (i = 0; i < n; i++) {
+				if (j >= l[i]) {
+					continue;
+				}
+				u = naf[i][j];
+				if (u > 0) {
+					ep2_add(r, r, t[i][u / 2]);
+				}
+				if (u < 0) {
+					ep2_sub(r, r, t[i][-u / 2]);
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(_k);
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_free(t[i][j]);
+			}
+		}
+	}
+}
+
+/**
+ * Multiplies and adds many prime elliptic curve points over quadratic
+ * extensions simultaneously by accumulating them in buckets indexed by signed
+ * window digits (Pippenger's method).
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integer scalars.
+ * @param[in] n					- the number of points to multiply.
+ */
+static void ep2_mul_sim_lot_bucket(ep2_t r, ep2_t p[], bn_t k[], int n) {
+	int i, j, b, c, w, d, bits;
+	long long cost, min;
+	ep2_t s, t, *u;
+
+	bits = 0;
+	for (i = 0; i < n; i++) {
+		bits = MAX(bits, bn_bits(k[i]));
+	}
+
+	/* Choose the window width minimizing the number of additions. */
+	c = 2;
+	min = (long long)(bits / c + 1) * (n + (1 << c));
+	for (w = 3; w <= EP2_LOT_WIDTH; w++) {
+		cost = (long long)(bits / w + 1) * (n + (1 << w));
+		if (cost < min) {
+			min = cost;
+			c = w;
+		}
+	}
+
+	u = (ep2_t *)malloc((1 << (c - 1)) * sizeof(ep2_t));
+	if (u == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	ep2_null(s);
+	ep2_null(t);
+	for (i = 0; i < (1 << (c - 1)); i++) {
+		ep2_null(u[i]);
+	}
+
+	TRY {
+		ep2_new(s);
+		ep2_new(t);
+		for (i = 0; i < (1 << (c - 1)); i++) {
+			ep2_new(u[i]);
+		}
+
+		ep2_set_infty(r);
+		for (j = bits / c; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep2_dbl(r, r);
+			}
+			for (i = 0; i < (1 << (c - 1)); i++) {
+				ep2_set_infty(u[i]);
+			}
+			for (i = 0; i < n; i++) {
+				/* Recode the window as a signed digit d, with |d| <= 2^(c-1). */
+				d = 0;
+				for (b = c - 1; b >= 0; b--) {
+					d = (d << 1) | bn_get_bit(k[i], j * c + b);
+				}
+				if (j > 0) {
+					d += bn_get_bit(k[i], j * c - 1);
+				}
+				d -= bn_get_bit(k[i], j * c + c - 1) << c;
+				if (bn_sign(k[i]) == BN_NEG) {
+					d = -d;
+				}
+				if (d > 0) {
+					ep2_add(u[d - 1], u[d - 1], p[i]);
+				}
+				if (d < 0) {
+					ep2_sub(u[-d - 1], u[-d - 1], p[i]);
+				}
+			}
+			/* Compute sum_i i * u[i - 1] with running sums. */
+			ep2_set_infty(s);
+			ep2_set_infty(t);
+			for (i = (1 << (c - 1)) - 1; i >= 0; i--) {
+				ep2_add(s, s, u[i]);
+				ep2_add(t, t, s);
+			}
+			ep2_add(r, r, t);
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep2_free(s);
+		ep2_free(t);
+		for (i = 0; i < (1 << (c - 1)); i++) {
+			ep2_free(u[i]);
+		}
+		free(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -343,3 +536,105 @@ void ep2_mul_sim_gen(ep2_t r, bn_t k, ep2_t q, bn_t l) {
 		ep2_free(gen);
 	}
 }
+
+void ep2_mul_sim_lot(ep2_t r, ep2_t p[], bn_t k[], int n) {
+	int i, j, d, bits = 0;
+	ep2_t *_p = NULL;
+	bn_t l, m, t, *_k = NULL;
+
+	bn_null(l);
+	bn_null(m);
+	bn_null(t);
+
+	TRY {
+		bn_new(l);
+		bn_new(m);
+		bn_new(t);
+
+		/* Decompose scalars in base lambda = p mod r, the eigenvalue of psi. */
+		d = 1;
+		if (ep2_curve_is_twist()) {
+			ep2_curve_get_ord(m);
+			bn_read_raw(l, fp_prime_get(), FP_DIGS);
+			bn_mod(l, l, m);
+			d = CEIL(bn_bits(m), bn_bits(l));
+		}
+
+		if (d == 1) {
+			for (i = 0; i < n; i++) {
+				bits = MAX(bits, bn_bits(k[i]));
+			}
+			if (n <= EP2_LOT_INTER && bits <= 2 * FP_BITS) {
+				ep2_mul_sim_lot_inter(r, p, k, n);
+			} else {
+				ep2_mul_sim_lot_bucket(r, p, k, n);
+			}
+		} else {
+			_p = (ep2_t *)malloc(n * d * sizeof(ep2_t));
+			_k = (bn_t *)malloc(n * d * sizeof(bn_t));
+			if (_p == NULL || _k == NULL) {
+				free(_p);
+				free(_k);
+				_p = NULL;
+				_k = NULL;
+				THROW(ERR_NO_MEMORY);
+			}
+		}
+
+		if (_p != NULL) {
+			for (i = 0; i < n * d; i++) {
+				ep2_null(_p[i]);
+				bn_null(_k[i]);
+			}
+
+			TRY {
+				for (i = 0; i < n; i++) {
+					for (j = 0; j < d; j++) {
+						ep2_new(_p[i * d + j]);
+						bn_new(_k[i * d + j]);
+					}
+					/* Compute psi^j(P_i), which equals lambda^j * P_i in G2. */
+					ep2_norm(_p[i * d], p[i]);
+					for (j = 1; j < d; j++) {
+						ep2_frb(_p[i * d + j], _p[i * d + j - 1], 1);
+					}
+					bn_abs(t, k[i]);
+					bn_mod(t, t, m);
+					for (j = 0; j < d - 1; j++) {
+						bn_div_rem(_k[i * d + j + 1], _k[i * d + j], t, l);
+						bn_copy(t, _k[i * d + j + 1]);
+					}
+					if (bn_sign(k[i]) == BN_NEG) {
+						for (j = 0; j < d; j++) {
+							bn_neg(_k[i * d + j], _k[i * d + j]);
+						}
+					}
+				}
+				if (n * d <= EP2_LOT_INTER) {
+					ep2_mul_sim_lot_inter(r, _p, _k, n * d);
+				} else {
+					ep2_mul_sim_lot_bucket(r, _p, _k, n * d);
+				}
+			}
+			CATCH_ANY {
+				THROW(ERR_CAUGHT);
+			}
+			FINALLY {
+				for (i = 0; i < n * d; i++) {
+					ep2_free(_p[i]);
+					bn_free(_k[i]);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(l);
+		bn_free(m);
+		bn_free(t);
+		free(_p);
+		free(_k);
+	}
+}
@@ -43,8 +43,9 @@
  *
  * @param r			- the result.
  * @param p			- the point to normalize.
+ * @param inverted	- if the Z coordinate is already inverted.
  */
-static void ep2_norm_imp(ep2_t r, ep2_t p) {
+static void ep2_norm_imp(ep2_t r, ep2_t p, int inverted) {
 	if (!p->norm) {
 		fp2_t t0, t1;
 
@@ -55,7 +56,11 @@ static void ep2_norm_imp(ep2_t r, ep2_t p) {
 			fp2_new(t0);
 			fp2_new(t1);
 
-			fp2_inv(t1, p->z);
+			if (inverted) {
+				fp2_copy(t1, p->z);
+			} else {
+				fp2_inv(t1, p->z);
+			}
 			fp2_sqr(t0, t1);
 			fp2_mul(r->x, p->x, t0);
 			fp2_mul(t0, t0, t1);
@@ -91,8 +96,57 @@ void ep2_norm(ep2_t r, ep2_t p) {
 	if (p->norm) {
 		/* If the point is represented in affine coordinates, we just copy it. */
 		ep2_copy(r, p);
+		return;
 	}
 #if EP_ADD == PROJC || !defined(STRIP)
-	ep2_norm_imp(r, p);
+	ep2_norm_imp(r, p, 0);
 #endif
 }
+
+void ep2_norm_sim(ep2_t *r, ep2_t *t, int n) {
+	int i;
+	fp2_t a[n];
+
+	if (n == 0) {
+		return;
+	}
+
+	for (i = 0; i < n; i++) {
+		fp2_null(a[i]);
+	}
+
+	TRY {
+		for (i = 0; i < n; i++) {
+			fp2_new(a[i]);
+			/* Points at infinity or in affine coordinates do not need z^-1. */
+			if (ep2_is_infty(t[i]) || t[i]->norm) {
+				fp2_set_dig(a[i], 1);
+			} else {
+				fp2_copy(a[i], t[i]->z);
+			}
+		}
+
+		fp2_inv_sim(a, a, n);
+
+		for (i = 0; i < n; i++) {
+			if (ep2_is_infty(t[i])) {
+				ep2_set_infty(r[i]);
+			} else if (t[i]->norm) {
+				ep2_copy(r[i], t[i]);
+			} else {
+				fp2_copy(r[i]->x, t[i]->x);
+				fp2_copy(r[i]->y, t[i]->y);
+				fp2_copy(r[i]->z, a[i]);
+				ep2_norm_imp(r[i], r[i], 1);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < n; i++) {
+			fp2_free(a[i]);
+		}
+	}
+}
@@ -116,7 +116,7 @@ static void find_trace() {
 static void find_solve() {
 	int i, j, k, l;
 	fb_t t0;
-	ctx_t *ctx = core_get();
+	fb_tab_t *tab = core_get()->fb_tab;
 
 	fb_null(t0);
 
@@ -132,14 +132,14 @@ static void find_solve() {
 						fb_set_bit(t0, i + 2 * k + 1, 1);
 					}
 				}
-				fb_copy(ctx->fb_half[l][j], t0);
+				fb_copy(tab->fb_half[l][j], t0);
 				for (k = 0; k < (FB_BITS - 1) / 2; k++) {
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_add(ctx->fb_half[l][j], ctx->fb_half[l][j], t0);
+					fb_sqr(tab->fb_half[l][j], tab->fb_half[l][j]);
+					fb_sqr(tab->fb_half[l][j], tab->fb_half[l][j]);
+					fb_add(tab->fb_half[l][j], tab->fb_half[l][j], t0);
 				}
 			}
-			fb_rsh(ctx->fb_half[l][j], ctx->fb_half[l][j], 1);
+			fb_rsh(tab->fb_half[l][j], tab->fb_half[l][j], 1);
 		}
 	}
 	CATCH_ANY {
@@ -168,7 +168,7 @@ static void find_srz() {
 
 #ifdef FB_PRECO
 	for (int i = 0; i <= 255; i++) {
-		fb_mul_dig(ctx->fb_tab_srz[i], ctx->fb_srz, i);
+		fb_mul_dig(ctx->fb_tab->fb_tab_srz[i], ctx->fb_srz, i);
 	}
 #endif
 }
@@ -271,7 +271,7 @@ static void find_chain() {
 
 	for (i = 0; i < MAX_TERMS; i++) {
 		for (j = 0; j < FB_TABLE; j++) {
-			ctx->fb_tab_ptr[i][j] = &(ctx->fb_tab_sqr[i][j]);
+			ctx->fb_tab->fb_tab_ptr[i][j] = &(ctx->fb_tab->fb_tab_sqr[i][j]);
 		}
 	}
 
@@ -300,7 +300,16 @@ static void find_chain() {
  * @param[in] f				- the new irreducible polynomial.
  */
 static void fb_poly_set(const fb_t f) {
-	fb_copy(core_get()->fb_poly, f);
+	ctx_t *ctx = core_get();
+
+	/* Never write to tables that other contexts are reading. */
+	ctx->fb_tab = (fb_tab_t *)core_tab_own(ctx->fb_tab, sizeof(fb_tab_t));
+	if (ctx->fb_tab == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	fb_copy(ctx->fb_poly, f);
 #if FB_TRC == QUICK || !defined(STRIP)
 	find_trace();
 #endif
@@ -325,9 +334,14 @@ void fb_poly_init(void) {
 	fb_zero(ctx->fb_poly);
 	ctx->fb_pa = ctx->fb_pb = ctx->fb_pc = 0;
 	ctx->fb_na = ctx->fb_nb = ctx->fb_nc = -1;
+	ctx->fb_tab = NULL;
 }
 
 void fb_poly_clean(void) {
+	ctx_t *ctx = core_get();
+
+	core_tab_free(ctx->fb_tab);
+	ctx->fb_tab = NULL;
 }
 
 dig_t *fb_poly_get(void) {
@@ -445,10 +459,15 @@ dig_t *fb_poly_get_srz(void) {
 const fb_t *fb_poly_tab_sqr(int i) {
 #if FB_INV == ITOHT || !defined(STRIP)
 	/* If ITOHT inversion is used and tables are precomputed, return them. */
+	fb_tab_t *tab = core_get()->fb_tab;
+
+	if (tab == NULL) {
+		return NULL;
+	}
 #if ALLOC == AUTO
-	return (const fb_t *)*core_get()->fb_tab_ptr[i];
+	return (const fb_t *)*tab->fb_tab_ptr[i];
 #else
-	return (const fb_t *)core_get()->fb_tab_ptr[i];
+	return (const fb_t *)tab->fb_tab_ptr[i];
 #endif
 
 #else
@@ -460,7 +479,9 @@ const dig_t *fb_poly_tab_srz(int i) {
 #if FB_SRT == QUICK || !defined(STRIP)
 
 #ifdef FB_PRECO
-	return core_get()->fb_tab_srz[i];
+	fb_tab_t *tab = core_get()->fb_tab;
+
+	return (tab == NULL ? NULL : tab->fb_tab_srz[i]);
 #else
 	return NULL;
 #endif
@@ -490,7 +511,9 @@ void fb_poly_get_rdc(int *a, int *b, int *c) {
 
 const dig_t *fb_poly_get_slv() {
 #if FB_SLV == QUICK || !defined(STRIP)
-	return (dig_t *)&(core_get()->fb_half);
+	fb_tab_t *tab = core_get()->fb_tab;
+
+	return (tab == NULL ? NULL : (dig_t *)&(tab->fb_half));
 #else
 	return NULL;
 #endif
@@ -130,6 +130,14 @@ void fp_sub_dig(fp_t c, const fp_t a, dig_t b) {
 #endif
 }
 
+void fp_addc(dv_t c, const dv_t a, const dv_t b) {
+	fp_addc_low(c, a, b);
+}
+
+void fp_subc(dv_t c, const dv_t a, const dv_t b) {
+	fp_subc_low(c, a, b);
+}
+
 #if FP_ADD == BASIC || !defined(STRIP)
 
 void fp_neg_basic(fp_t c, const fp_t a) {
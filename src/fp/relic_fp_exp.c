@@ -32,6 +32,197 @@
 #include "relic_core.h"
 #include "relic_util.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum width of the windows used in addition chains.
+ */
+#define CHAIN_WIDTH		5
+
+/**
+ * Represents an addition chain under construction.
+ */
+typedef struct {
+	/** The chain being built, or NULL if only the cost is computed. */
+	fp_chain_t *ch;
+	/** The number of steps. */
+	int len;
+	/** The number of temporary values. */
+	int regs;
+	/** The cost of the chain, weighting squarings as 4/5 of a multiplication. */
+	int cost;
+	/** The number of runs of ones already computed. */
+	int runs;
+	/** The lengths of the runs of ones already computed. */
+	int run_len[FP_CHAIN_REG];
+	/** The temporary values holding the runs of ones. */
+	int run_reg[FP_CHAIN_REG];
+} chain_t;
+
+/**
+ * Returns the temporary value holding an odd power in an addition chain.
+ *
+ * @param[in] V				- the odd power.
+ */
+#define CHAIN_ODD(V)	((V) == 1 ? 0 : ((V) + 1) / 2)
+
+/**
+ * Appends a step r[dst] = r[src]^(2^sqr) * r[mul] to an addition chain.
+ *
+ * @param[in,out] s			- the addition chain under construction.
+ * @param[in] dst			- the temporary value to write.
+ * @param[in] src			- the temporary value to square.
+ * @param[in] sqr			- the number of squarings.
+ * @param[in] mul			- the temporary value to multiply, or FP_CHAIN_REG.
+ */
+static void fp_exp_step(chain_t *s, int dst, int src, int sqr, int mul) {
+	if (s->ch != NULL && s->len < FP_CHAIN_LEN) {
+		s->ch->dst[s->len] = dst;
+		s->ch->src[s->len] = src;
+		s->ch->sqr[s->len] = sqr;
+		s->ch->mul[s->len] = mul;
+	}
+	s->len++;
+	s->cost += 4 * sqr + (mul != FP_CHAIN_REG ? 5 : 0);
+}
+
+/**
+ * Returns the temporary value holding x^(2^k - 1), appending the steps that
+ * compute it as x^(2^k - 1) = (x^(2^h - 1))^(2^l) * x^(2^l - 1), h + l = k.
+ *
+ * @param[in,out] s			- the addition chain under construction.
+ * @param[in] k				- the length of the run of ones.
+ * @return the temporary value.
+ */
+static int fp_exp_run(chain_t *s, int k) {
+	int h, l, i;
+
+	for (i = 0; i < s->runs; i++) {
+		if (s->run_len[i] == k) {
+			return s->run_reg[i];
+		}
+	}
+
+	l = k / 2;
+	h = fp_exp_run(s, k - l);
+	i = fp_exp_run(s, l);
+	fp_exp_step(s, s->regs, h, l, i);
+	if (s->runs < FP_CHAIN_REG) {
+		s->run_len[s->runs] = k;
+		s->run_reg[s->runs++] = s->regs;
+	}
+	return s->regs++;
+}
+
+/**
+ * Extracts the next digit of an exponent, scanning from the most significant
+ * bits. A digit is either a run of at least r ones or an odd window of at most
+ * w bits.
+ *
+ * @param[in] b				- the exponent.
+ * @param[in,out] i			- the position of the next bit to scan.
+ * @param[in] w				- the window width.
+ * @param[in] r				- the minimum length of a run.
+ * @param[out] low			- the position of the lowest bit of the digit.
+ * @return the odd value of the window, minus the length of the run or zero if
+ * there are no more digits.
+ */
+static int fp_exp_dig(const bn_t b, int *i, int w, int r, int *low) {
+	int j, v;
+
+	while (*i >= 0 && !bn_get_bit(b, *i)) {
+		(*i)--;
+	}
+	if (*i < 0) {
+		return 0;
+	}
+
+	for (j = *i; j >= 0 && bn_get_bit(b, j); j--);
+	if (*i - j >= r) {
+		v = -(*i - j);
+		*low = j + 1;
+		*i = j;
+		return v;
+	}
+
+	j = MAX(*i - w + 1, 0);
+	while (!bn_get_bit(b, j)) {
+		j++;
+	}
+	for (v = 0; *i >= j; (*i)--) {
+		v = (v << 1) | bn_get_bit(b, *i);
+	}
+	*low = j;
+	return v;
+}
+
+/**
+ * Builds an addition chain for an exponent recoded with windows of width w and
+ * runs of at least r ones.
+ *
+ * @param[out] ch			- the addition chain, or NULL to compute the cost.
+ * @param[in] b				- the exponent.
+ * @param[in] w				- the window width.
+ * @param[in] r				- the minimum length of a run.
+ * @return the cost of the chain, or -1 if it does not fit an fp_chain_t.
+ */
+static int fp_exp_try(fp_chain_t *ch, const bn_t b, int w, int r) {
+	chain_t s;
+	int d, i, k, low, acc, last, max = 1;
+
+	s.ch = ch;
+	s.len = s.cost = 0;
+	s.regs = 1;
+	s.runs = 1;
+	s.run_len[0] = 1;
+	s.run_reg[0] = 0;
+
+	/* Compute the odd powers used by the windows. */
+	i = bn_bits(b) - 1;
+	while ((d = fp_exp_dig(b, &i, w, r, &low)) != 0) {
+		max = MAX(max, d);
+	}
+	if (max > 1) {
+		fp_exp_step(&s, 1, 0, 1, FP_CHAIN_REG);
+		for (k = 3; k <= max; k += 2) {
+			fp_exp_step(&s, CHAIN_ODD(k), CHAIN_ODD(k - 2), 0, 1);
+		}
+		s.regs = CHAIN_ODD(max) + 1;
+		/* Runs of ones shorter than the windows are already computed. */
+		for (k = 2; (1 << k) - 1 <= max; k++) {
+			s.run_len[s.runs] = k;
+			s.run_reg[s.runs++] = CHAIN_ODD((1 << k) - 1);
+		}
+	}
+
+	acc = s.regs++;
+	last = -1;
+	i = bn_bits(b) - 1;
+	while ((d = fp_exp_dig(b, &i, w, r, &low)) != 0) {
+		k = (d > 0 ? CHAIN_ODD(d) : fp_exp_run(&s, -d));
+		if (last < 0) {
+			fp_exp_step(&s, acc, k, 0, FP_CHAIN_REG);
+		} else {
+			fp_exp_step(&s, acc, acc, last - low, k);
+		}
+		last = low;
+	}
+	if (last > 0) {
+		fp_exp_step(&s, acc, acc, last, FP_CHAIN_REG);
+	}
+
+	if (s.len > FP_CHAIN_LEN || s.regs > FP_CHAIN_REG) {
+		return -1;
+	}
+	if (ch != NULL) {
+		ch->len = s.len;
+		ch->regs = s.regs;
+	}
+	return s.cost;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -162,3 +353,102 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b) {
 }
 
 #endif
+
+void fp_exp_gen(fp_chain_t *ch, const bn_t b) {
+	int i, j, k, c, w, r, n, best = -1, bw = CHAIN_WIDTH, br = 0;
+	int lens[FP_CHAIN_REG];
+
+	ch->len = ch->regs = 0;
+	ch->sign = bn_sign(b);
+	if (bn_is_zero(b)) {
+		return;
+	}
+
+	/* Collect the lengths of the runs of ones as candidate thresholds. */
+	n = 0;
+	for (i = bn_bits(b) - 1; i >= 0; i = j) {
+		for (j = i; j >= 0 && bn_get_bit(b, j); j--);
+		if (j < i) {
+			for (k = 0; k < n && lens[k] != i - j; k++);
+			if (k == n && n < FP_CHAIN_REG - 1) {
+				lens[n++] = i - j;
+			}
+		} else {
+			j--;
+		}
+	}
+	/* A threshold longer than the exponent disables runs. */
+	lens[n++] = bn_bits(b) + 1;
+
+	for (w = 1; w <= CHAIN_WIDTH; w++) {
+		for (k = 0; k < n; k++) {
+			r = lens[k];
+			if (r <= w) {
+				continue;
+			}
+			c = fp_exp_try(NULL, b, w, r);
+			if (c >= 0 && (best < 0 || c < best)) {
+				best = c;
+				bw = w;
+				br = r;
+			}
+		}
+	}
+
+	if (best < 0) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+	fp_exp_try(ch, b, bw, br);
+}
+
+void fp_exp_chain(fp_t c, const fp_t a, const fp_chain_t *ch) {
+	fp_t r[FP_CHAIN_REG];
+	int i, j, d, s;
+
+	if (ch->len == 0) {
+		fp_set_dig(c, 1);
+		return;
+	}
+
+	for (i = 0; i < ch->regs; i++) {
+		fp_null(r[i]);
+	}
+
+	TRY {
+		for (i = 0; i < ch->regs; i++) {
+			fp_new(r[i]);
+		}
+
+		fp_copy(r[0], a);
+		for (i = 0; i < ch->len; i++) {
+			d = ch->dst[i];
+			s = ch->src[i];
+			if (ch->sqr[i] > 0) {
+				fp_sqr(r[d], r[s]);
+				for (j = 1; j < ch->sqr[i]; j++) {
+					fp_sqr(r[d], r[d]);
+				}
+				s = d;
+			}
+			if (ch->mul[i] != FP_CHAIN_REG) {
+				fp_mul(r[d], r[s], r[ch->mul[i]]);
+			} else if (d != s) {
+				fp_copy(r[d], r[s]);
+			}
+		}
+		if (ch->sign == BN_NEG) {
+			fp_inv(c, r[ch->dst[ch->len - 1]]);
+		} else {
+			fp_copy(c, r[ch->dst[ch->len - 1]]);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < ch->regs; i++) {
+			fp_free(r[i]);
+		}
+	}
+}
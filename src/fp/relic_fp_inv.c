@@ -40,25 +40,8 @@
 #if FP_INV == BASIC || !defined(STRIP)
 
 void fp_inv_basic(fp_t c, const fp_t a) {
-	bn_t e;
-
-	bn_null(e);
-
-	TRY {
-		bn_new(e);
-
-		e->used = FP_DIGS;
-		dv_copy(e->dp, fp_prime_get(), FP_DIGS);
-		bn_sub_dig(e, e, 2);
-
-		fp_exp(c, a, e);
-	}
-	CATCH_ANY {
-		THROW(ERR_CAUGHT);
-	}
-	FINALLY {
-		bn_free(e);
-	}
+	/* Compute a^(p - 2) with the addition chain fixed for the prime. */
+	fp_exp_chain(c, a, fp_prime_get_chain(FP_CHAIN_INV));
 }
 
 #endif
@@ -392,35 +375,60 @@ void fp_inv_lower(fp_t c, const fp_t a) {
 #endif
 
 void fp_inv_sim(fp_t *c, const fp_t *a, int n) {
-	int i;
-	fp_t u, t[n];
+	int i, j, l;
+	fp_t u[FP_LANES], t[n];
+
+	/*
+	 * With vector instructions, interleave independent chains of products so
+	 * that each step computes one multiplication per lane.
+	 */
+	l = fp_lanes_low();
+	if (n < 2 * l) {
+		l = 1;
+	}
 
 	for (i = 0; i < n; i++) {
 		fp_null(t[i]);
 	}
-	fp_null(u);
+	for (i = 0; i < l; i++) {
+		fp_null(u[i]);
+	}
 
 	TRY {
 		for (i = 0; i < n; i++) {
 			fp_new(t[i]);
+			fp_copy(t[i], a[i]);
+		}
+		for (i = 0; i < l; i++) {
+			fp_new(u[i]);
 		}
-		fp_new(u);
-
-		fp_copy(c[0], a[0]);
-		fp_copy(t[0], a[0]);
 
-		for (i = 1; i < n; i++) {
-			fp_copy(t[i], a[i]);
-			fp_mul(c[i], c[i - 1], a[i]);
+		for (i = 0; i < l; i++) {
+			fp_copy(c[i], a[i]);
+		}
+		for (i = l; i < n; i += l) {
+			fp_mul_sim(c + i, (const fp_t *)c + i - l, (const fp_t *)t + i,
+					MIN(l, n - i));
 		}
 
-		fp_inv(u, c[n - 1]);
+		/* The last l products close the chains, chain j holding index j mod l. */
+		if (l == 1) {
+			fp_inv(u[0], c[n - 1]);
+		} else {
+			fp_inv_sim(c + n - l, (const fp_t *)c + n - l, l);
+			for (i = 0; i < l; i++) {
+				fp_copy(u[(n - l + i) % l], c[n - l + i]);
+			}
+		}
 
-		for (i = n - 1; i > 0; i--) {
-			fp_mul(c[i], u, c[i - 1]);
-			fp_mul(u, u, t[i]);
+		for (i = ((n - 1) / l) * l; i > 0; i -= l) {
+			j = MIN(l, n - i);
+			fp_mul_sim(c + i, (const fp_t *)u, (const fp_t *)c + i - l, j);
+			fp_mul_sim(u, (const fp_t *)u, (const fp_t *)t + i, j);
+		}
+		for (i = 0; i < l; i++) {
+			fp_copy(c[i], u[i]);
 		}
-		fp_copy(c[0], u);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -429,6 +437,8 @@ void fp_inv_sim(fp_t *c, const fp_t *a, int n) {
 		for (i = 0; i < n; i++) {
 			fp_free(t[i]);
 		}
-		fp_free(u);
+		for (i = 0; i < l; i++) {
+			fp_free(u[i]);
+		}
 	}
 }
@@ -180,6 +180,66 @@ void fp_mul_dig(fp_t c, const fp_t a, dig_t b) {
 	}
 }
 
+void fp_mul_unr(dv_t c, const fp_t a, const fp_t b) {
+	fp_muln_low(c, a, b);
+}
+
+void fp_mla_unr(dv_t c, const fp_t a, const fp_t b) {
+	dv_t t;
+
+	dv_null(t);
+
+	TRY {
+		dv_new(t);
+		fp_muln_low(t, a, b);
+		fp_addc_low(c, c, t);
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		dv_free(t);
+	}
+}
+
+void fp_mls_unr(dv_t c, const fp_t a, const fp_t b) {
+	dv_t t;
+
+	dv_null(t);
+
+	TRY {
+		dv_new(t);
+		fp_muln_low(t, a, b);
+		fp_subc_low(c, c, t);
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		dv_free(t);
+	}
+}
+
+void fp_mul_sim(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	dig_t *pc[FP_LANES];
+	const dig_t *pa[FP_LANES], *pb[FP_LANES];
+	int i, j, l = fp_lanes_low();
+
+	if (l == 1) {
+		for (i = 0; i < n; i++) {
+			fp_mul(c[i], a[i], b[i]);
+		}
+		return;
+	}
+
+	for (i = 0; i < n; i += l) {
+		for (j = 0; j < l && i + j < n; j++) {
+			pc[j] = c[i + j];
+			pa[j] = a[i + j];
+			pb[j] = b[i + j];
+		}
+		fp_mulv_low(pc, pa, pb, j);
+	}
+}
+
 #if FP_MUL == BASIC || !defined(STRIP)
 
 void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
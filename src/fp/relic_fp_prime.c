@@ -102,6 +102,20 @@ static void fp_prime_set(const bn_t p) {
 		bn_lsh(&(ctx->one), &(ctx->one), ctx->prime.used * BN_DIGIT);
 		bn_mod(&(ctx->one), &(ctx->one), &(ctx->prime));
 #endif
+
+		/* Compute the addition chains for the fixed exponents. */
+		bn_sub_dig(t, &(ctx->prime), 2);
+		fp_exp_gen(&(ctx->fp_chains[FP_CHAIN_INV]), t);
+		bn_rsh(t, &(ctx->prime), 1);
+		fp_exp_gen(&(ctx->fp_chains[FP_CHAIN_LEG]), t);
+		if (ctx->mod8 == 3 || ctx->mod8 == 7) {
+			bn_add_dig(t, &(ctx->prime), 1);
+			bn_rsh(t, t, 2);
+			fp_exp_gen(&(ctx->fp_chains[FP_CHAIN_SRT]), t);
+		} else {
+			ctx->fp_chains[FP_CHAIN_SRT].len = 0;
+		}
+
 		fp_prime_calc();
 	}
 	CATCH_ANY {
@@ -298,6 +312,10 @@ void fp_prime_init() {
 	ctx_t *ctx = core_get();
 	ctx->fp_id = ctx->sps_len = 0;
 	memset(ctx->sps, 0, sizeof(ctx->sps));
+	for (int i = 0; i < FP_CHAINS; i++) {
+		ctx->fp_chains[i].len = ctx->fp_chains[i].regs = 0;
+		ctx->fp_chains[i].sign = BN_POS;
+	}
 	bn_init(&(ctx->prime), FP_DIGS);
 #if FP_RDC == MONTY || !defined(STRIP)
 	bn_init(&(ctx->conv), FP_DIGS);
@@ -309,6 +327,10 @@ void fp_prime_clean() {
 	ctx_t *ctx = core_get();
 	ctx->fp_id = ctx->sps_len = 0;
 	memset(ctx->sps, 0, sizeof(ctx->sps));
+	for (int i = 0; i < FP_CHAINS; i++) {
+		ctx->fp_chains[i].len = ctx->fp_chains[i].regs = 0;
+		ctx->fp_chains[i].sign = BN_POS;
+	}
 #if FP_RDC == MONTY || !defined(STRIP)
 	bn_clean(&(ctx->one));
 	bn_clean(&(ctx->conv));
@@ -359,6 +381,10 @@ int fp_prime_get_cnr() {
 	return core_get()->cnr;
 }
 
+const fp_chain_t *fp_prime_get_chain(int id) {
+	return &(core_get()->fp_chains[id]);
+}
+
 void fp_prime_set_dense(const bn_t p) {
 	fp_prime_set(p);
 	core_get()->sps_len = 0;
@@ -155,6 +155,10 @@ static void fp_sqr_karat_imp(dv_t c, const fp_t a, int size, int level) {
 /* Public definitions                                                         */
 /*============================================================================*/
 
+void fp_sqr_unr(dv_t c, const fp_t a) {
+	fp_sqrn_low(c, a);
+}
+
 #if FP_SQR == BASIC || !defined(STRIP)
 
 void fp_sqr_basic(fp_t c, const fp_t a) {
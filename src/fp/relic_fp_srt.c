@@ -56,10 +56,7 @@ int fp_srt(fp_t c, const fp_t a) {
 
 		if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
 			/* Easy case, compute a^((p + 1)/4). */
-			bn_add_dig(e, e, 1);
-			bn_rsh(e, e, 2);
-
-			fp_exp(t0, a, e);
+			fp_exp_chain(t0, a, fp_prime_get_chain(FP_CHAIN_SRT));
 			fp_sqr(t1, t0);
 			r = (fp_cmp(t1, a) == CMP_EQ);
 			fp_copy(c, t0);
@@ -68,7 +65,7 @@ int fp_srt(fp_t c, const fp_t a) {
 
 			/* First, check if there is a root. Compute t1 = a^((p - 1)/2). */
 			bn_rsh(e, e, 1);
-			fp_exp(t0, a, e);
+			fp_exp_chain(t0, a, fp_prime_get_chain(FP_CHAIN_LEG));
 
 			if (fp_cmp_dig(t0, 1) != CMP_EQ) {
 				/* Nope, there is no square root. */
@@ -79,7 +76,7 @@ int fp_srt(fp_t c, const fp_t a) {
 				 * such that (t2 | p) = t2^((p - 1)/2)!= 1. */
 				do {
 					fp_rand(t1);
-					fp_exp(t0, t1, e);
+					fp_exp_chain(t0, t1, fp_prime_get_chain(FP_CHAIN_LEG));
 				} while (fp_cmp_dig(t0, 1) == CMP_EQ);
 
 				/* Write p - 1 as (e * 2^f), odd e. */
@@ -342,7 +342,10 @@ void fp12_exp_cyc_sps(fp12_t c, fp12_t a, int *b, int len) {
 		fp12_new(t);
 
 		fp12_copy(t, a);
-		if (b[0] == 0) {
+		if (fp12_cmp_dig(a, 1)) {
+			/* The identity has no invertible compressed representation. */
+			fp12_set_dig(c, 1);
+		} else if (b[0] == 0) {
 			for (j = 0, i = 1; i < len; i++) {
 				k = (b[i] < 0 ? -b[i] : b[i]);
 				for (; j < k; j++) {
@@ -32,91 +32,129 @@
 
 #include "relic_bn.h"
 #include "relic_bn_low.h"
+#include "relic_arch.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
 /*============================================================================*/
 
+#if ARCH == X64 && WORD == 64
+#if defined(CPUID) || (defined(__BMI2__) && defined(__ADX__))
 /**
- * Accumulates a double precision digit in a triple register variable.
- *
- * @param[in,out] R2		- most significant word of the triple register.
- * @param[in,out] R1		- middle word of the triple register.
- * @param[in,out] R0		- lowest significant word of the triple register.
- * @param[in] A				- the first digit to multiply.
- * @param[in] B				- the second digit to multiply.
+ * Indicates that the MULX/ADX row kernel is available.
+ */
+#define BN_MULX
+#endif
+#endif
+
+#ifdef BN_MULX
+
+/**
+ * Tests if the MULX/ADX row kernel can be used on this processor.
  */
-#define COMBA_STEP(R2, R1, R0, A, B)										\
-	dbl_t r = (dbl_t)(A) * (dbl_t)(B);										\
-	dig_t _r = (R1);														\
-	(R0) += (dig_t)(r);														\
-	(R1) += (R0) < (dig_t)(r);												\
-	(R2) += (R1) < _r;														\
-	(R1) += (dig_t)(r >> (dbl_t)BN_DIGIT);									\
-	(R2) += (R1) < (dig_t)(r >> (dbl_t)BN_DIGIT);							\
+#ifdef CPUID
+#define bn_mulx_on()														\
+	((arch_get_ext() & (ARCH_BMI2 | ARCH_ADX)) == (ARCH_BMI2 | ARCH_ADX))	\
+
+#else
+#define bn_mulx_on()		1
+#endif
 
 /**
- * Accumulates a single precision digit in a triple register variable.
+ * Multiplies a digit vector by a digit and accumulates the result, keeping
+ * the carries of the product and of the accumulation in two independent
+ * chains with ADCX and ADOX. The counter is updated with LEA and tested with
+ * JRCXZ, since neither touches the carry and overflow flags.
  *
- * @param[in,out] R2		- most significant word of the triple register.
- * @param[in,out] R1		- middle word of the triple register.
- * @param[in,out] R0		- lowest significant word of the triple register.
- * @param[in] A				- the first digit to accumulate.
+ * @param[in,out] c			- the digit vector to accumulate.
+ * @param[in] a				- the digit vector to multiply.
+ * @param[in] digit			- the digit to multiply.
+ * @param[in] size			- the number of digits, at least one.
+ * @return the carry of the last digit.
  */
-#define COMBA_ADD(R2, R1, R0, A)											\
-	dig_t __r = (R1);														\
-	(R0) += (A);															\
-	(R1) += (R0) < (A);														\
-	(R2) += (R1) < __r;														\
+static inline dig_t bn_mula_mulx(dig_t *c, const dig_t *a, dig_t digit,
+		int size) {
+	dig_t r;
+	long n = size;
+
+	__asm__ volatile (
+		"xorl	%%r10d, %%r10d\n\t"
+		"1:\n\t"
+		"mulx	(%[ap]), %%r8, %%r9\n\t"
+		"adcx	%%r10, %%r8\n\t"
+		"adox	(%[cp]), %%r8\n\t"
+		"movq	%%r8, (%[cp])\n\t"
+		"movq	%%r9, %%r10\n\t"
+		"leaq	8(%[ap]), %[ap]\n\t"
+		"leaq	8(%[cp]), %[cp]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jrcxz	2f\n\t"
+		"jmp	1b\n\t"
+		"2:\n\t"
+		"movl	$0, %%r8d\n\t"
+		"adcx	%%r8, %%r10\n\t"
+		"adox	%%r8, %%r10\n\t"
+		"movq	%%r10, %[r]\n\t"
+		: [r] "=r" (r), [ap] "+r" (a), [cp] "+r" (c), "+c" (n)
+		: "d" (digit)
+		: "r8", "r9", "r10", "cc", "memory"
+	);
+	return r;
+}
+
+#endif /* BN_MULX */
 
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-void bn_modn_low(dig_t *c, const dig_t *a, int sa, const dig_t *m, int sm, dig_t u) {
+void bn_modn_low(dig_t *c, const dig_t *a, int sa, const dig_t *m, int sm,
+		dig_t u) {
 	int i, j;
-	dig_t r0, r1, r2;
-	dig_t *tmp, *tmpc;
-	const dig_t *tmpm;
-
-	tmpc = c;
+	dig_t r, carry, top, t;
+	dbl_t s;
 
-	r0 = r1 = r2 = 0;
-	for (i = 0; i < sm; i++, tmpc++, a++) {
-		tmp = c;
-		tmpm = m + i;
-		for (j = 0; j < i; j++, tmp++, tmpm--) {
-			COMBA_STEP(r2, r1, r0, *tmp, *tmpm);
-		}
-		if (i < sa) {
-			COMBA_ADD(r2, r1, r0, *a);
-		}
-		*tmpc = (dig_t)(r0 * u);
-		COMBA_STEP(r2, r1, r0, *tmpc, *m);
-		r0 = r1;
-		r1 = r2;
-		r2 = 0;
+	if (sa > 2 * sm) {
+		sa = 2 * sm;
 	}
-	for (i = sm; i < 2 * sm - 1; i++, a++) {
-		tmp = c + (i - sm + 1);
-		tmpm = m + sm - 1;
-		for (j = i - sm + 1; j < sm; j++, tmp++, tmpm--) {
-			COMBA_STEP(r2, r1, r0, *tmp, *tmpm);
-		}
-		if (i < sa) {
-			COMBA_ADD(r2, r1, r0, *a);
+	for (i = 0; i < sa; i++) {
+		c[i] = a[i];
+	}
+	for (; i < 2 * sm; i++) {
+		c[i] = 0;
+	}
+
+	/*
+	 * Operand scanning keeps the carry in a single digit, which is cheaper
+	 * than the triple register needed by product scanning. The carry out of
+	 * the top digit is kept apart, so only 2 * sm digits are needed.
+	 */
+	top = 0;
+	for (i = 0; i < sm; i++) {
+		r = (dig_t)(c[i] * u);
+#ifdef BN_MULX
+		if (bn_mulx_on()) {
+			carry = bn_mula_mulx(c + i, m, r, sm);
+		} else
+#endif
+		{
+			carry = 0;
+			for (j = 0; j < sm; j++) {
+				s = (dbl_t)c[i + j] + (dbl_t)r * (dbl_t)m[j] + (dbl_t)carry;
+				c[i + j] = (dig_t)s;
+				carry = (dig_t)(s >> (dbl_t)BN_DIGIT);
+			}
 		}
-		c[i - sm] = r0;
-		r0 = r1;
-		r1 = r2;
-		r2 = 0;
+		t = c[i + sm] + carry;
+		carry = (t < carry);
+		c[i + sm] = t + top;
+		top = carry | (c[i + sm] < top);
 	}
 
-	if (i < sa) {
-		COMBA_ADD(r2, r1, r0, *a);
+	for (i = 0; i < sm; i++) {
+		c[i] = c[i + sm];
 	}
-	c[sm - 1] = r0;
-	if (r1) {
+	if (top) {
 		bn_subn_low(c, c, m, sm);
 	}
 }
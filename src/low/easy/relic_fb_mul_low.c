@@ -35,6 +35,65 @@
 #include "relic_fb_low.h"
 #include "relic_bn_low.h"
 #include "relic_util.h"
+#include "relic_arch.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if defined(CPUID) && ARCH == X64 && WORD == 64
+
+#include <wmmintrin.h>
+
+/**
+ * Multiplies two binary field digit vectors of the same size using carry-less
+ * multiplication instructions.
+ *
+ * @param[out] c			- the result, with 2 * size digits.
+ * @param[in] a				- the first digit vector to multiply.
+ * @param[in] b				- the second digit vector to multiply.
+ * @param[in] size			- the number of digits to multiply.
+ */
+__attribute__((target("pclmul,sse2")))
+static void fb_muld_clmul(dig_t *c, const dig_t *a, const dig_t *b, int size) {
+	__m128i p, x;
+	int i, j;
+
+	dv_zero(c, 2 * size);
+	for (i = 0; i < size; i++) {
+		x = _mm_cvtsi64_si128(a[i]);
+		for (j = 0; j < size; j++) {
+			p = _mm_clmulepi64_si128(x, _mm_cvtsi64_si128(b[j]), 0x00);
+			c[i + j] ^= (dig_t)_mm_cvtsi128_si64(p);
+			c[i + j + 1] ^= (dig_t)_mm_cvtsi128_si64(_mm_srli_si128(p, 8));
+		}
+	}
+}
+
+/**
+ * Multiplies a binary field digit vector by a digit using carry-less
+ * multiplication instructions.
+ *
+ * @param[out] c			- the result, with FB_DIGS + 1 digits.
+ * @param[in] a				- the digit vector to multiply.
+ * @param[in] digit			- the digit to multiply.
+ */
+__attribute__((target("pclmul,sse2")))
+static void fb_mul1_clmul(dig_t *c, const dig_t *a, dig_t digit) {
+	__m128i p, x;
+	dig_t carry = 0;
+	int i;
+
+	x = _mm_cvtsi64_si128(digit);
+	for (i = 0; i < FB_DIGS; i++) {
+		p = _mm_clmulepi64_si128(x, _mm_cvtsi64_si128(a[i]), 0x00);
+		c[i] = carry ^ (dig_t)_mm_cvtsi128_si64(p);
+		carry = (dig_t)_mm_cvtsi128_si64(_mm_srli_si128(p, 8));
+	}
+	c[FB_DIGS] = carry;
+}
+
+#endif
 
 /*============================================================================*/
 /* Public definitions                                                         */
@@ -44,6 +103,13 @@ void fb_mul1_low(dig_t *c, const dig_t *a, dig_t digit) {
 	int j, k;
 	dig_t b1, b2;
 
+#if defined(CPUID) && ARCH == X64 && WORD == 64
+	if (arch_get_ext() & ARCH_CLMUL) {
+		fb_mul1_clmul(c, a, digit);
+		return;
+	}
+#endif
+
 	if (digit == 0) {
 		dv_zero(c, FB_DIGS + 1);
 		return;
@@ -81,6 +147,13 @@ void fb_muln_low(dig_t *c, const dig_t *a, const dig_t *b) {
 	const dig_t *tmpa;
 	int i, j;
 
+#if defined(CPUID) && ARCH == X64 && WORD == 64
+	if (arch_get_ext() & ARCH_CLMUL) {
+		fb_muld_clmul(c, a, b, FB_DIGS);
+		return;
+	}
+#endif
+
 	for (i = 0; i < 2 * FB_DIGS; i++) {
 		c[i] = 0;
 	}
@@ -154,6 +227,13 @@ void fb_muld_low(dig_t *c, const dig_t *a, const dig_t *b, int size) {
 	const dig_t *tmpa;
 	int i, j;
 
+#if defined(CPUID) && ARCH == X64 && WORD == 64
+	if (arch_get_ext() & ARCH_CLMUL) {
+		fb_muld_clmul(c, a, b, size);
+		return;
+	}
+#endif
+
 	dv_zero(c, 2 * size);
 
 	for (i = 0; i < 16; i++) {
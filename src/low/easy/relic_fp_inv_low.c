@@ -40,18 +40,10 @@
 /*============================================================================*/
 
 void fp_invn_low(dig_t *c, const dig_t *a) {
-	bn_st e;
-
-	bn_init(&e, FP_DIGS);
-
-	e.used = FP_DIGS;
-	dv_copy(e.dp, fp_prime_get(), FP_DIGS);
-	bn_sub1_low(e.dp, e.dp, 2, FP_DIGS);
+	/* Compute a^(p - 2) with the addition chain fixed for the prime. */
 #if AUTO == ALLOC
-	fp_exp(c, a, &e);
+	fp_exp_chain(c, a, fp_prime_get_chain(FP_CHAIN_INV));
 #else
-	fp_exp(c, (const fp_t)a, &e);
+	fp_exp_chain(c, (const fp_t)a, fp_prime_get_chain(FP_CHAIN_INV));
 #endif
-
-	bn_clean(&e);
 }
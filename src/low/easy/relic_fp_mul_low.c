@@ -31,6 +31,7 @@
 
 #include "relic_fp.h"
 #include "relic_fp_low.h"
+#include "relic_fp_mulx.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -63,6 +64,12 @@ dig_t fp_mula_low(dig_t *c, const dig_t *a, dig_t digit) {
 	dig_t carry;
 	dbl_t r;
 
+#ifdef FP_MULX
+	if (fp_mulx_on()) {
+		return fp_mula_mulx(c, a, digit);
+	}
+#endif
+
 	carry = 0;
 	for (i = 0; i < FP_DIGS; i++, a++, c++) {
 		/* Multiply the digit *tmpa by b and accumulate with the previous
@@ -99,6 +106,13 @@ void fp_muln_low(dig_t *c, const dig_t *a, const dig_t *b) {
 	const dig_t *tmpa, *tmpb;
 	dig_t r0, r1, r2;
 
+#ifdef FP_MULX
+	if (fp_mulx_on()) {
+		fp_muln_mulx(c, a, b);
+		return;
+	}
+#endif
+
 	r0 = r1 = r2 = 0;
 	for (i = 0; i < FP_DIGS; i++, c++) {
 		tmpa = a;
@@ -127,6 +141,13 @@ void fp_muln_low(dig_t *c, const dig_t *a, const dig_t *b) {
 void fp_mulm_low(dig_t *c, const dig_t *a, const dig_t *b) {
 	dig_t align t[2 * FP_DIGS];
 
+#if defined(FP_MULX) && FP_RDC == MONTY
+	if (fp_mulx_on()) {
+		fp_mulm_mulx(c, a, b, fp_prime_get(), *(fp_prime_get_rdc()));
+		return;
+	}
+#endif
+
 	fp_muln_low(t, a, b);
 	fp_rdc(c, t);
 }
@@ -0,0 +1,262 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2014 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level multi-lane prime field multiplication.
+ *
+ * On x86-64 processors supporting AVX-512 IFMA, each of the FP_LANES lanes of
+ * a 512-bit register holds one operand in radix 2^52 and the eight Montgomery
+ * multiplications proceed in lockstep. The reduction still divides by
+ * 2^(FP_DIGIT * FP_DIGS), so the results are identical to fp_mulm_low().
+ *
+ * @version $Id$
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_arch.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/*
+ * The kernel keeps the whole double-precision product in registers, so it is
+ * restricted to primes of up to 1024 bits.
+ */
+#if ARCH == X64 && WORD == 64 && FP_RDC == MONTY && FP_PRIME <= 1024
+#if defined(CPUID) || defined(__AVX512IFMA__)
+/**
+ * Indicates that the AVX-512 IFMA kernel is available.
+ */
+#define FP_IFMA
+#endif
+#endif
+
+#ifdef FP_IFMA
+
+#include <immintrin.h>
+
+/**
+ * Tests if the AVX-512 IFMA kernel can be used on this processor.
+ */
+#ifdef CPUID
+#define fp_ifma_on()		(arch_get_ext() & ARCH_IFMA)
+#else
+#define fp_ifma_on()		1
+#endif
+
+/**
+ * Number of 52-bit limbs of a prime field element.
+ */
+#define IFMA_LIMBS		((FP_PRIME + 51) / 52)
+
+/**
+ * Number of reduction steps that clear 52 bits each.
+ */
+#define IFMA_STEPS		((FP_DIGS * FP_DIGIT) / 52)
+
+/**
+ * Number of bits cleared by the final, partial reduction step.
+ */
+#define IFMA_REM		((FP_DIGS * FP_DIGIT) % 52)
+
+/**
+ * Mask selecting the lower 52 bits of a lane.
+ */
+#define IFMA_MASK		((((uint64_t)1) << 52) - 1)
+
+/**
+ * Gathers one digit vector per lane and converts it to radix 2^52.
+ *
+ * @param[out] r			- the limbs of each lane.
+ * @param[in] p				- the addresses of the digit vectors.
+ * @param[in] k				- the mask of active lanes.
+ */
+__attribute__((target("avx512f,avx512ifma")))
+static inline void fp_ifma_load(__m512i *r, __m512i p, __mmask8 k) {
+	__m512i x[FP_DIGS + 1], v, m = _mm512_set1_epi64(IFMA_MASK);
+	int i, j, o;
+
+	for (i = 0; i < FP_DIGS; i++) {
+		x[i] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), k,
+				_mm512_add_epi64(p, _mm512_set1_epi64(i * sizeof(dig_t))),
+				NULL, 1);
+	}
+	x[FP_DIGS] = _mm512_setzero_si512();
+
+	for (j = 0; j < IFMA_LIMBS; j++) {
+		i = (52 * j) / FP_DIGIT;
+		o = (52 * j) % FP_DIGIT;
+		v = _mm512_srli_epi64(x[i], o);
+		if (o > FP_DIGIT - 52) {
+			v = _mm512_or_si512(v, _mm512_slli_epi64(x[i + 1], FP_DIGIT - o));
+		}
+		r[j] = _mm512_and_si512(v, m);
+	}
+}
+
+/**
+ * Converts the limbs of each lane back to radix 2^64 and scatters them.
+ *
+ * @param[in] p				- the addresses of the digit vectors.
+ * @param[in] r				- the limbs of each lane.
+ * @param[in] k				- the mask of active lanes.
+ */
+__attribute__((target("avx512f,avx512ifma")))
+static inline void fp_ifma_store(__m512i p, const __m512i *r, __mmask8 k) {
+	__m512i v;
+	int i, j, o;
+
+	for (i = 0; i < FP_DIGS; i++) {
+		j = (FP_DIGIT * i) / 52;
+		o = (FP_DIGIT * i) % 52;
+		v = _mm512_srli_epi64(r[j], o);
+		if (j + 1 < IFMA_LIMBS) {
+			v = _mm512_or_si512(v, _mm512_slli_epi64(r[j + 1], 52 - o));
+		}
+		if (104 - o < FP_DIGIT && j + 2 < IFMA_LIMBS) {
+			v = _mm512_or_si512(v, _mm512_slli_epi64(r[j + 2], 104 - o));
+		}
+		_mm512_mask_i64scatter_epi64(NULL, k,
+				_mm512_add_epi64(p, _mm512_set1_epi64(i * sizeof(dig_t))), v, 1);
+	}
+}
+
+/**
+ * Multiplies up to FP_LANES pairs of prime field elements with Montgomery
+ * reduction using AVX-512 IFMA instructions.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first digit vectors to multiply.
+ * @param[in] b				- the second digit vectors to multiply.
+ * @param[in] n				- the number of products.
+ */
+__attribute__((target("avx512f,avx512ifma")))
+static void fp_mulv_ifma(dig_t *c[], const dig_t *a[], const dig_t *b[],
+		int n) {
+	__m512i va[IFMA_LIMBS], vb[IFMA_LIMBS], vp[IFMA_LIMBS];
+	__m512i t[2 * IFMA_LIMBS + 3], r[IFMA_LIMBS + 1], d[IFMA_LIMBS + 1];
+	__m512i q, u, w, z = _mm512_setzero_si512();
+	__m512i m = _mm512_set1_epi64(IFMA_MASK);
+	__mmask8 k = (__mmask8)((1 << n) - 1);
+	int i, j;
+
+	/* Load every input before storing, so the outputs may alias them. */
+	fp_ifma_load(va, _mm512_maskz_loadu_epi64(k, a), k);
+	fp_ifma_load(vb, _mm512_maskz_loadu_epi64(k, b), k);
+	fp_ifma_load(vp, _mm512_set1_epi64((intptr_t)fp_prime_get()), 0xFF);
+	u = _mm512_set1_epi64(*(fp_prime_get_rdc()) & IFMA_MASK);
+
+	for (i = 0; i < 2 * IFMA_LIMBS + 3; i++) {
+		t[i] = z;
+	}
+	for (i = 0; i < IFMA_LIMBS; i++) {
+		for (j = 0; j < IFMA_LIMBS; j++) {
+			t[i + j] = _mm512_madd52lo_epu64(t[i + j], va[i], vb[j]);
+			t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], va[i], vb[j]);
+		}
+	}
+
+	/* Each step clears the lower 52 bits of the accumulator. */
+	for (i = 0; i <= IFMA_STEPS; i++) {
+		q = _mm512_madd52lo_epu64(z, t[i], u);
+		if (i == IFMA_STEPS) {
+			if (IFMA_REM == 0) {
+				break;
+			}
+			/* The last step only clears the bits left to reach the digits. */
+			q = _mm512_and_si512(q,
+					_mm512_set1_epi64((((uint64_t)1) << IFMA_REM) - 1));
+		}
+		for (j = 0; j < IFMA_LIMBS; j++) {
+			t[i + j] = _mm512_madd52lo_epu64(t[i + j], q, vp[j]);
+			t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], q, vp[j]);
+		}
+		if (i < IFMA_STEPS) {
+			t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+		}
+	}
+
+	/* Propagate the carries and drop the bits cleared by the reduction. */
+	for (i = IFMA_STEPS; i < 2 * IFMA_LIMBS + 2; i++) {
+		t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+		t[i] = _mm512_and_si512(t[i], m);
+	}
+	for (j = 0; j <= IFMA_LIMBS; j++) {
+		r[j] = t[IFMA_STEPS + j];
+		if (IFMA_REM != 0) {
+			r[j] = _mm512_or_si512(_mm512_srli_epi64(r[j], IFMA_REM),
+					_mm512_and_si512(_mm512_slli_epi64(t[IFMA_STEPS + j + 1],
+									52 - IFMA_REM), m));
+		}
+	}
+
+	/* Subtract the prime in the lanes where the result is not reduced. */
+	w = z;
+	for (j = 0; j <= IFMA_LIMBS; j++) {
+		d[j] = _mm512_sub_epi64(r[j], (j < IFMA_LIMBS ? vp[j] : z));
+		d[j] = _mm512_sub_epi64(d[j], w);
+		w = _mm512_srli_epi64(d[j], 63);
+		d[j] = _mm512_and_si512(d[j], m);
+	}
+	k = _mm512_cmpeq_epi64_mask(w, z);
+	for (j = 0; j < IFMA_LIMBS; j++) {
+		r[j] = _mm512_mask_blend_epi64(k, r[j], d[j]);
+	}
+
+	k = (__mmask8)((1 << n) - 1);
+	fp_ifma_store(_mm512_maskz_loadu_epi64(k, c), r, k);
+}
+
+#endif /* FP_IFMA */
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int fp_lanes_low(void) {
+#ifdef FP_IFMA
+	if (fp_ifma_on()) {
+		return FP_LANES;
+	}
+#endif
+	return 1;
+}
+
+void fp_mulv_low(dig_t *c[], const dig_t *a[], const dig_t *b[], int n) {
+	int i;
+
+#ifdef FP_IFMA
+	if (fp_ifma_on()) {
+		fp_mulv_ifma(c, a, b, n);
+		return;
+	}
+#endif
+
+	for (i = 0; i < n; i++) {
+		fp_mulm_low(c[i], a[i], b[i]);
+	}
+}
@@ -0,0 +1,197 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2014 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Prime field multiplication kernels for x86-64 processors supporting the
+ * BMI2 and ADX extensions, shared by the low-level prime field modules.
+ *
+ * Each row of a product or of a Montgomery reduction is computed by MULX
+ * while two independent carry chains are kept by ADCX and ADOX. The rows are
+ * unrolled by the assembler for the configured FP_DIGS, so the same code
+ * serves any prime size.
+ *
+ * @version $Id$
+ * @ingroup fp
+ */
+
+#ifndef RELIC_FP_MULX_H
+#define RELIC_FP_MULX_H
+
+#include "relic_core.h"
+#include "relic_arch.h"
+
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+#if ARCH == X64 && WORD == 64
+#if defined(CPUID) || (defined(__BMI2__) && defined(__ADX__))
+/**
+ * Indicates that the MULX/ADX kernels are available.
+ */
+#define FP_MULX
+#endif
+#endif
+
+/*============================================================================*/
+/* Macro definitions                                                          */
+/*============================================================================*/
+
+/**
+ * Tests if the MULX/ADX kernels can be used on this processor.
+ */
+#ifdef CPUID
+#define fp_mulx_on()														\
+	((arch_get_ext() & (ARCH_BMI2 | ARCH_ADX)) == (ARCH_BMI2 | ARCH_ADX))	\
+
+#else
+#define fp_mulx_on()		1
+#endif
+
+#ifdef FP_MULX
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Multiplies a digit vector by a digit and accumulates the result.
+ *
+ * @param[in,out] c			- the digit vector to accumulate, with FP_DIGS digits.
+ * @param[in] a				- the digit vector to multiply.
+ * @param[in] digit			- the digit to multiply.
+ * @return the carry of the last digit.
+ */
+static inline dig_t fp_mula_mulx(dig_t *c, const dig_t *a, dig_t digit) {
+	dig_t r;
+
+	__asm__ volatile (
+		"xorl	%%r10d, %%r10d\n\t"
+		".set	fp_mulx_j, 0\n\t"
+		".rept	%c[n]\n\t"
+		"mulx	8*fp_mulx_j(%[ap]), %%r8, %%r9\n\t"
+		"adcx	%%r10, %%r8\n\t"
+		"adox	8*fp_mulx_j(%[cp]), %%r8\n\t"
+		"movq	%%r8, 8*fp_mulx_j(%[cp])\n\t"
+		"movq	%%r9, %%r10\n\t"
+		".set	fp_mulx_j, fp_mulx_j + 1\n\t"
+		".endr\n\t"
+		"movl	$0, %%r8d\n\t"
+		"adcx	%%r8, %%r10\n\t"
+		"adox	%%r8, %%r10\n\t"
+		"movq	%%r10, %[r]\n\t"
+		: [r] "=r" (r)
+		: [ap] "r" (a), [cp] "r" (c), "d" (digit), [n] "i" (FP_DIGS)
+		: "r8", "r9", "r10", "cc", "memory"
+	);
+	return r;
+}
+
+/**
+ * Multiplies two prime field elements without reduction.
+ *
+ * @param[out] c			- the result, with 2 * FP_DIGS digits.
+ * @param[in] a				- the first prime field element.
+ * @param[in] b				- the second prime field element.
+ */
+static inline void fp_muln_mulx(dig_t *c, const dig_t *a, const dig_t *b) {
+	int i;
+
+	for (i = 0; i < FP_DIGS; i++) {
+		c[i] = 0;
+	}
+	for (i = 0; i < FP_DIGS; i++) {
+		c[i + FP_DIGS] = fp_mula_mulx(c + i, a, b[i]);
+	}
+}
+
+/**
+ * Reduces a double precision digit vector modulo the prime field modulus
+ * using Montgomery reduction.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the digit vector to reduce.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery reduction constant.
+ */
+static inline void fp_rdcn_mulx(dig_t *c, const dig_t *a, const dig_t *m,
+		dig_t u) {
+	dig_t t[2 * FP_DIGS], carry, s, top = 0;
+	int i;
+
+	for (i = 0; i < 2 * FP_DIGS; i++) {
+		t[i] = a[i];
+	}
+	for (i = 0; i < FP_DIGS; i++) {
+		carry = fp_mula_mulx(t + i, m, (dig_t)(t[i] * u));
+		s = t[i + FP_DIGS] + carry;
+		carry = (s < carry);
+		t[i + FP_DIGS] = s + top;
+		top = carry | (t[i + FP_DIGS] < top);
+	}
+	if (top || fp_cmpn_low(t + FP_DIGS, m) != CMP_LT) {
+		fp_subn_low(c, t + FP_DIGS, m);
+	} else {
+		fp_copy(c, t + FP_DIGS);
+	}
+}
+
+/**
+ * Multiplies two prime field elements in Montgomery form, interleaving each
+ * row of the product with a row of the reduction.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first prime field element.
+ * @param[in] b				- the second prime field element.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery reduction constant.
+ */
+static inline void fp_mulm_mulx(dig_t *c, const dig_t *a, const dig_t *b,
+		const dig_t *m, dig_t u) {
+	dig_t t[2 * FP_DIGS + 1], carry, s;
+	int i;
+
+	for (i = 0; i < 2 * FP_DIGS + 1; i++) {
+		t[i] = 0;
+	}
+	for (i = 0; i < FP_DIGS; i++) {
+		carry = fp_mula_mulx(t + i, a, b[i]);
+		s = t[i + FP_DIGS] + carry;
+		t[i + FP_DIGS + 1] += (s < carry);
+		t[i + FP_DIGS] = s;
+		carry = fp_mula_mulx(t + i, m, (dig_t)(t[i] * u));
+		s = t[i + FP_DIGS] + carry;
+		t[i + FP_DIGS + 1] += (s < carry);
+		t[i + FP_DIGS] = s;
+	}
+	if (t[2 * FP_DIGS] || fp_cmpn_low(t + FP_DIGS, m) != CMP_LT) {
+		fp_subn_low(c, t + FP_DIGS, m);
+	} else {
+		fp_copy(c, t + FP_DIGS);
+	}
+}
+
+#endif /* FP_MULX */
+
+#endif /* !RELIC_FP_MULX_H */
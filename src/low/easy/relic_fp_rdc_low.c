@@ -33,6 +33,7 @@
 #include "relic_fp.h"
 #include "relic_fp_low.h"
 #include "relic_bn_low.h"
+#include "relic_fp_mulx.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -155,6 +156,13 @@ void fp_rdcn_low(dig_t *c, dig_t *a) {
 	m = fp_prime_get();
 	tmpc = c;
 
+#ifdef FP_MULX
+	if (fp_mulx_on()) {
+		fp_rdcn_mulx(c, a, m, u);
+		return;
+	}
+#endif
+
 	r0 = r1 = r2 = 0;
 	for (i = 0; i < FP_DIGS; i++, tmpc++, a++) {
 		tmp = c;
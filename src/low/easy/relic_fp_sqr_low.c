@@ -31,6 +31,7 @@
 
 #include "relic_fp.h"
 #include "relic_fp_low.h"
+#include "relic_fp_mulx.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -82,6 +83,13 @@ void fp_sqrn_low(dig_t *c, const dig_t *a) {
 	const dig_t *tmpa, *tmpb;
 	dig_t r0, r1, r2;
 
+#ifdef FP_MULX
+	if (fp_mulx_on()) {
+		fp_muln_mulx(c, a, a);
+		return;
+	}
+#endif
+
 	/* Zero the accumulator. */
 	r0 = r1 = r2 = 0;
 
@@ -123,6 +131,13 @@ void fp_sqrn_low(dig_t *c, const dig_t *a) {
 void fp_sqrm_low(dig_t *c, const dig_t *a) {
 	dig_t align t[2 * FP_DIGS];
 
+#if defined(FP_MULX) && FP_RDC == MONTY
+	if (fp_mulx_on()) {
+		fp_mulm_mulx(c, a, a, fp_prime_get(), *(fp_prime_get_rdc()));
+		return;
+	}
+#endif
+
 	fp_sqrn_low(t, a);
 	fp_rdc(c, t);
 }
@@ -29,6 +29,8 @@
  * @ingroup pp
  */
 
+#include <stdlib.h>
+
 #include "relic_core.h"
 #include "relic_pp.h"
 #include "relic_util.h"
@@ -217,6 +219,94 @@ static void pp_mil_sps_k12(fp12_t r, ep2_t t, ep2_t q, ep_t p, int *s, int len)
 	}
 }
 
+/**
+ * Compute the Miller loops for a product of pairings of type G_2 x G_1 over
+ * the bits of a given parameter represented in sparse form. The squarings of
+ * the accumulator are shared among all the pairings.
+ *
+ * @param[out] r			- the result.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the first points of the pairings, in G_2.
+ * @param[in] p				- the second points of the pairings, in G_1.
+ * @param[in] m				- the number of pairings to evaluate.
+ * @param[in] s				- the loop parameter in sparse form.
+ * @paramin] len			- the length of the loop parameter.
+ */
+static void pp_mil_sps_lot_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m,
+		int *s, int len) {
+	fp12_t l;
+	ep_t *_p;
+	ep2_t *_q;
+	int i, j;
+
+	_p = (ep_t *)malloc(m * sizeof(ep_t));
+	_q = (ep2_t *)malloc(m * sizeof(ep2_t));
+	if (_p == NULL || _q == NULL) {
+		free(_p);
+		free(_q);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	fp12_null(l);
+	for (j = 0; j < m; j++) {
+		ep_null(_p[j]);
+		ep2_null(_q[j]);
+	}
+
+	TRY {
+		fp12_new(l);
+		for (j = 0; j < m; j++) {
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
+			ep2_copy(t[j], q[j]);
+			ep2_neg(_q[j], q[j]);
+#if EP_ADD == BASIC
+			fp_copy(_p[j]->x, p[j]->x);
+			fp_neg(_p[j]->y, p[j]->y);
+#else
+			fp_neg(_p[j]->y, p[j]->y);
+			fp_add(_p[j]->x, p[j]->x, p[j]->x);
+			fp_add(_p[j]->x, _p[j]->x, p[j]->x);
+#endif
+		}
+
+		fp12_zero(l);
+		fp12_zero(r);
+		fp_set_dig(r[0][0][0], 1);
+
+		for (i = len - 2; i >= 0; i--) {
+			if (i < len - 2) {
+				fp12_sqr(r, r);
+			}
+			for (j = 0; j < m; j++) {
+				pp_dbl_k12(l, t[j], t[j], _p[j]);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] > 0) {
+					pp_add_k12(l, t[j], q[j], p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+				if (s[i] < 0) {
+					pp_add_k12(l, t[j], _q[j], p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(l);
+		for (j = 0; j < m; j++) {
+			ep_free(_p[j]);
+			ep2_free(_q[j]);
+		}
+		free(_p);
+		free(_q);
+	}
+}
+
 /**
  * Compute the Miller loop for pairings of type G_1 x G_2 over the bits of a
  * given parameter.
@@ -259,6 +349,55 @@ static void pp_mil_lit_k12(fp12_t r, ep_t t, ep_t p, ep2_t q, bn_t a) {
 	}
 }
 
+/**
+ * Compute the Miller loops for a product of pairings of type G_1 x G_2 over
+ * the bits of a given parameter. The squarings of the accumulator are shared
+ * among all the pairings.
+ *
+ * @param[out] r			- the result.
+ * @param[out] t			- the resulting points.
+ * @param[in] p				- the first points of the pairings, in G_1.
+ * @param[in] q				- the second points of the pairings, in G_2.
+ * @param[in] m				- the number of pairings to evaluate.
+ * @param[in] a				- the loop parameter.
+ */
+static void pp_mil_lit_lot_k12(fp12_t r, ep_t *t, ep_t *p, ep2_t *q, int m,
+		bn_t a) {
+	fp12_t l;
+	int i, j;
+
+	fp12_null(l);
+
+	TRY {
+		fp12_new(l);
+		fp12_zero(l);
+
+		for (j = 0; j < m; j++) {
+			ep_copy(t[j], p[j]);
+		}
+		fp12_zero(r);
+		fp_set_dig(r[0][0][0], 1);
+
+		for (i = bn_bits(a) - 2; i >= 0; i--) {
+			fp12_sqr(r, r);
+			for (j = 0; j < m; j++) {
+				pp_dbl_lit_k12(l, t[j], t[j], q[j]);
+				fp12_mul(r, r, l);
+				if (bn_get_bit(a, i)) {
+					pp_add_lit_k12(l, t[j], p[j], q[j]);
+					fp12_mul(r, r, l);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(l);
+	}
+}
+
 /**
  * Compute the final lines for optimal ate pairings.
  *
@@ -305,6 +444,48 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, ep2_t q, ep_t p) {
 }
 
 
+/**
+ * Stores the coefficients of a sparse line function in a precomputation table.
+ *
+ * @param[out] t			- the table entry.
+ * @param[in] l				- the line function evaluated at (1, 1).
+ */
+static void pp_lin_get_k12(fp6_t t, fp12_t l) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(t[0], l[zero][zero]);
+	fp2_copy(t[1], l[one][zero]);
+	fp2_copy(t[2], l[one][one]);
+}
+
+/**
+ * Evaluates a line function stored in a precomputation table at an affine
+ * point.
+ *
+ * @param[out] l			- the result of the evaluation.
+ * @param[in] t				- the table entry.
+ * @param[in] p				- the affine point to evaluate the line function.
+ */
+static void pp_lin_set_k12(fp12_t l, fp6_t t, ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp_mul(l[zero][zero][0], t[0][0], p->y);
+	fp_mul(l[zero][zero][1], t[0][1], p->y);
+	fp_mul(l[one][zero][0], t[1][0], p->x);
+	fp_mul(l[one][zero][1], t[1][1], p->x);
+	fp2_copy(l[one][one], t[2]);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -326,6 +507,8 @@ void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q) {
 	ep_null(t);
 	bn_null(n);
 
+	arena_open();
+
 	TRY {
 		ep_new(t);
 		bn_new(n);
@@ -343,6 +526,57 @@ void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q) {
 		ep_free(t);
 		bn_free(n);
 	}
+	arena_close();
+}
+
+void pp_map_sim_tatep_k2(fp2_t r, ep_t *p, ep_t *q, int m) {
+	ep_t t, _p, _q;
+	fp2_t f;
+	bn_t n;
+	int j;
+
+	ep_null(t);
+	ep_null(_p);
+	ep_null(_q);
+	fp2_null(f);
+	bn_null(n);
+
+	arena_open();
+
+	TRY {
+		ep_new(t);
+		ep_new(_p);
+		ep_new(_q);
+		fp2_new(f);
+		bn_new(n);
+
+		ep_curve_get_ord(n);
+		/* Since p has order n, we do not have to perform last iteration. */
+		bn_sub_dig(n, n, 1);
+
+		fp2_zero(r);
+		fp_set_dig(r[0], 1);
+		for (j = 0; j < m; j++) {
+			if (!ep_is_infty(p[j]) && !ep_is_infty(q[j])) {
+				ep_norm(_p, p[j]);
+				ep_norm(_q, q[j]);
+				pp_mil_k2(f, t, _p, _q, n);
+				fp2_mul(r, r, f);
+			}
+		}
+		pp_exp_k2(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(t);
+		ep_free(_p);
+		ep_free(_q);
+		fp2_free(f);
+		bn_free(n);
+	}
+	arena_close();
 }
 
 #endif
@@ -356,6 +590,8 @@ void pp_map_tatep_k12(fp12_t r, ep_t p, ep2_t q) {
 	ep_null(t);
 	bn_null(n);
 
+	arena_open();
+
 	TRY {
 		ep_new(t);
 		bn_new(n);
@@ -371,6 +607,78 @@ void pp_map_tatep_k12(fp12_t r, ep_t p, ep2_t q) {
 		ep_free(t);
 		bn_free(n);
 	}
+	arena_close();
+}
+
+void pp_map_sim_tatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	ep_t *t, *_p;
+	ep2_t *_q;
+	bn_t n;
+	int i, j;
+
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
+	t = (ep_t *)malloc(m * sizeof(ep_t));
+	_p = (ep_t *)malloc(m * sizeof(ep_t));
+	_q = (ep2_t *)malloc(m * sizeof(ep2_t));
+	if (t == NULL || _p == NULL || _q == NULL) {
+		free(t);
+		free(_p);
+		free(_q);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(n);
+	for (j = 0; j < m; j++) {
+		ep_null(t[j]);
+		ep_null(_p[j]);
+		ep2_null(_q[j]);
+	}
+
+	arena_open();
+
+	TRY {
+		bn_new(n);
+		for (j = 0; j < m; j++) {
+			ep_new(t[j]);
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
+		}
+
+		/* Pairs with a point at infinity contribute nothing to the product. */
+		for (i = j = 0; j < m; j++) {
+			if (!ep_is_infty(p[j]) && !ep2_is_infty(q[j])) {
+				ep_norm(_p[i], p[j]);
+				ep2_norm(_q[i++], q[j]);
+			}
+		}
+
+		ep_curve_get_ord(n);
+		fp12_set_dig(r, 1);
+		if (i > 0) {
+			pp_mil_lit_lot_k12(r, t, _p, _q, i, n);
+			pp_exp_k12(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		for (j = 0; j < m; j++) {
+			ep_free(t[j]);
+			ep_free(_p[j]);
+			ep2_free(_q[j]);
+		}
+		free(t);
+		free(_p);
+		free(_q);
+	}
+	arena_close();
 }
 
 #endif
@@ -389,6 +697,8 @@ void pp_map_weilp_k2(fp2_t r, ep_t p, ep_t q) {
 	fp2_null(r1);
 	bn_null(n);
 
+	arena_open();
+
 	TRY {
 		ep_new(t0);
 		ep_new(t1);
@@ -414,6 +724,37 @@ void pp_map_weilp_k2(fp2_t r, ep_t p, ep_t q) {
 		fp2_free(r1);
 		bn_free(n);
 	}
+	arena_close();
+}
+
+void pp_map_sim_weilp_k2(fp2_t r, ep_t *p, ep_t *q, int m) {
+	fp2_t t;
+	int j;
+
+	fp2_null(t);
+
+	arena_open();
+
+	TRY {
+		fp2_new(t);
+
+		/* The Weil pairing has no final exponentiation to share. */
+		fp2_zero(r);
+		fp_set_dig(r[0], 1);
+		for (j = 0; j < m; j++) {
+			if (!ep_is_infty(p[j]) && !ep_is_infty(q[j])) {
+				pp_map_weilp_k2(t, p[j], q[j]);
+				fp2_mul(r, r, t);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(t);
+	}
+	arena_close();
 }
 
 void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q) {
@@ -428,6 +769,8 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q) {
 	fp12_null(r1);
 	bn_null(n);
 
+	arena_open();
+
 	TRY {
 		ep_new(t0);
 		ep2_new(t1);
@@ -455,6 +798,36 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q) {
 		fp12_free(r1);
 		bn_free(n);
 	}
+	arena_close();
+}
+
+void pp_map_sim_weilp_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	fp12_t t;
+	int j;
+
+	fp12_null(t);
+
+	arena_open();
+
+	TRY {
+		fp12_new(t);
+
+		/* The Weil pairing has no final exponentiation to share. */
+		fp12_set_dig(r, 1);
+		for (j = 0; j < m; j++) {
+			if (!ep_is_infty(p[j]) && !ep2_is_infty(q[j])) {
+				pp_map_weilp_k12(t, p[j], q[j]);
+				fp12_mul(r, r, t);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(t);
+	}
+	arena_close();
 }
 
 #endif
@@ -470,6 +843,8 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 	ep2_null(t);
 	bn_null(a);
 
+	arena_open();
+
 	TRY {
 		ep2_new(t);
 		bn_new(a);
@@ -512,6 +887,294 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 		ep2_free(t);
 		bn_free(a);
 	}
+	arena_close();
+}
+
+void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	ep_t *_p;
+	ep2_t *t, *_q;
+	bn_t a;
+	int i, j, len = FP_BITS, s[FP_BITS];
+
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
+	_p = (ep_t *)malloc(m * sizeof(ep_t));
+	t = (ep2_t *)malloc(m * sizeof(ep2_t));
+	_q = (ep2_t *)malloc(m * sizeof(ep2_t));
+	if (_p == NULL || t == NULL || _q == NULL) {
+		free(_p);
+		free(t);
+		free(_q);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(a);
+	for (j = 0; j < m; j++) {
+		ep_null(_p[j]);
+		ep2_null(_q[j]);
+		ep2_null(t[j]);
+	}
+
+	arena_open();
+
+	TRY {
+		bn_new(a);
+		for (j = 0; j < m; j++) {
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
+			ep2_new(t[j]);
+		}
+
+		/* Pairs with a point at infinity contribute nothing to the product. */
+		for (i = j = 0; j < m; j++) {
+			if (!ep_is_infty(p[j]) && !ep2_is_infty(q[j])) {
+				ep_norm(_p[i], p[j]);
+				ep2_norm(_q[i++], q[j]);
+			}
+		}
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		fp12_set_dig(r, 1);
+		if (i > 0) {
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P638:
+					/* r = prod f_{|a|,Q_j}(P_j). */
+					pp_mil_sps_lot_k12(r, t, _q, _p, i, s, len);
+					if (bn_sign(a) == BN_NEG) {
+						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+						fp12_inv_uni(r, r);
+						for (j = 0; j < i; j++) {
+							ep2_neg(t[j], t[j]);
+						}
+					}
+					for (j = 0; j < i; j++) {
+						pp_fin_k12_oatep(r, t[j], _q[j], _p[j]);
+					}
+					pp_exp_k12(r, r);
+					break;
+				case B12_P638:
+					/* r = prod f_{|a|,Q_j}(P_j). */
+					pp_mil_sps_lot_k12(r, t, _q, _p, i, s, len);
+					if (bn_sign(a) == BN_NEG) {
+						fp12_inv_uni(r, r);
+					}
+					pp_exp_k12(r, r);
+					break;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a);
+		for (j = 0; j < m; j++) {
+			ep_free(_p[j]);
+			ep2_free(_q[j]);
+			ep2_free(t[j]);
+		}
+		free(_p);
+		free(t);
+		free(_q);
+	}
+	arena_close();
+}
+
+void pp_map_pre_k12(fp6_t *t, ep2_t q) {
+	fp12_t l;
+	ep_t u, v;
+	ep2_t r, _q, q1, q2;
+	bn_t a;
+	int i, j = 0, len = FP_BITS, s[FP_BITS];
+
+	fp12_null(l);
+	ep_null(u);
+	ep_null(v);
+	ep2_null(r);
+	ep2_null(_q);
+	ep2_null(q1);
+	ep2_null(q2);
+	bn_null(a);
+
+	arena_open();
+
+	TRY {
+		fp12_new(l);
+		ep_new(u);
+		ep_new(v);
+		ep2_new(r);
+		ep2_new(_q);
+		ep2_new(q1);
+		ep2_new(q2);
+		bn_new(a);
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		for (i = len - 2; i >= 0; i--) {
+			j += (s[i] == 0 ? 1 : 2);
+		}
+		if (j + 2 > PP_TABLE) {
+			THROW(ERR_NO_BUFFER);
+		}
+
+		/*
+		 * The line functions are linear in the coordinates of the point in
+		 * G_1, so we evaluate them at points which absorb the constants the
+		 * Miller loop would apply to that point: (3, -1) for doublings in
+		 * projective coordinates and (1, 1) for additions.
+		 */
+#if EP_ADD == BASIC
+		fp_set_dig(u->x, 1);
+#else
+		fp_set_dig(u->x, 3);
+#endif
+		fp_set_dig(u->y, 1);
+		fp_neg(u->y, u->y);
+		fp_set_dig(u->z, 1);
+		u->norm = 1;
+		fp_set_dig(v->x, 1);
+		fp_set_dig(v->y, 1);
+		fp_set_dig(v->z, 1);
+		v->norm = 1;
+
+		ep2_norm(_q, q);
+		ep2_neg(q1, _q);
+		ep2_copy(r, _q);
+		fp12_zero(l);
+
+		j = 0;
+		for (i = len - 2; i >= 0; i--) {
+			pp_dbl_k12(l, r, r, u);
+			pp_lin_get_k12(t[j++], l);
+			if (s[i] > 0) {
+				pp_add_k12(l, r, _q, v);
+				pp_lin_get_k12(t[j++], l);
+			}
+			if (s[i] < 0) {
+				pp_add_k12(l, r, q1, v);
+				pp_lin_get_k12(t[j++], l);
+			}
+		}
+
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P638:
+				if (bn_sign(a) == BN_NEG) {
+					ep2_neg(r, r);
+				}
+				fp_set_dig(q1->z[0], 1);
+				fp_zero(q1->z[1]);
+				fp_set_dig(q2->z[0], 1);
+				fp_zero(q2->z[1]);
+				ep2_frb(q1, _q, 1);
+				ep2_frb(q2, _q, 2);
+				ep2_neg(q2, q2);
+				pp_add_k12(l, r, q1, v);
+				pp_lin_get_k12(t[j++], l);
+				pp_add_k12(l, r, q2, v);
+				pp_lin_get_k12(t[j++], l);
+				break;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(l);
+		ep_free(u);
+		ep_free(v);
+		ep2_free(r);
+		ep2_free(_q);
+		ep2_free(q1);
+		ep2_free(q2);
+		bn_free(a);
+	}
+	arena_close();
+}
+
+void pp_map_fix_k12(fp12_t r, ep_t p, fp6_t *t) {
+	fp12_t l;
+	ep_t _p;
+	bn_t a;
+	int i, j = 0, len = FP_BITS, s[FP_BITS];
+
+	fp12_null(l);
+	ep_null(_p);
+	bn_null(a);
+
+	arena_open();
+
+	TRY {
+		fp12_new(l);
+		ep_new(_p);
+		bn_new(a);
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		fp12_set_dig(r, 1);
+		if (!ep_is_infty(p)) {
+			ep_norm(_p, p);
+			fp12_zero(l);
+
+			/* r = f_{|a|,Q}(P), using only the stored lines. */
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					fp12_sqr(r, r);
+				}
+				pp_lin_set_k12(l, t[j++], _p);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_lin_set_k12(l, t[j++], _p);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+			if (bn_sign(a) == BN_NEG) {
+				/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+				fp12_inv_uni(r, r);
+			}
+
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P638:
+					pp_lin_set_k12(l, t[j++], _p);
+					fp12_mul_dxs(r, r, l);
+					pp_lin_set_k12(l, t[j++], _p);
+					fp12_mul_dxs(r, r, l);
+					break;
+			}
+			pp_exp_k12(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(l);
+		ep_free(_p);
+		bn_free(a);
+	}
+	arena_close();
 }
 
 #endif
@@ -0,0 +1,285 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2014 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the memory-management routines for the arena allocator,
+ * which bumps temporaries from per-thread blocks of memory and releases them
+ * at once when a scope is closed.
+ *
+ * @version $Id$
+ * @ingroup relic
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "relic_core.h"
+#include "relic_conf.h"
+#include "relic_arena.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if ALLOC == ARENA
+
+/**
+ * Represents an open arena scope, stored in the arena itself.
+ */
+typedef struct _mark_t {
+	/** The block in use when the scope was opened. */
+	arena_t *blk;
+	/** The number of bytes used in that block when the scope was opened. */
+	size_t top;
+	/** The enclosing scope. */
+	struct _mark_t *prev;
+} mark_t;
+
+/**
+ * Rounds a size up to the arena alignment.
+ */
+#define ROUND(S)	(((S) + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1))
+
+/**
+ * Returns the address of the header word preceding a memory area.
+ */
+#define HEAD(A)		(((size_t *)(A))[-1])
+
+/**
+ * Returns the address of the usable memory of a block.
+ */
+#define DATA(B)		((uint8_t *)(B) + ROUND(sizeof(arena_t)))
+
+/**
+ * Allocates aligned memory from the heap. The address returned by malloc() is
+ * stored right before the aligned memory.
+ *
+ * @param[in] size			- the number of bytes to allocate.
+ * @return the allocated memory, or NULL if no memory is left.
+ */
+static void *arena_heap(size_t size) {
+	uint8_t *p, *t;
+
+	p = (uint8_t *)malloc(size + ARENA_ALIGN + sizeof(void *));
+	if (p == NULL) {
+		return NULL;
+	}
+	t = (uint8_t *)ROUND((uintptr_t)(p + sizeof(void *)));
+	((void **)t)[-1] = p;
+	return t;
+}
+
+/**
+ * Frees memory allocated by arena_heap().
+ *
+ * @param[in] p				- the memory to free.
+ */
+static void arena_free(void *p) {
+	free(((void **)p)[-1]);
+}
+
+/**
+ * Bumps memory from the current block of the arena, moving to the next block
+ * if necessary. Each allocation is preceded by a header storing its size.
+ *
+ * @param[in,out] ctx		- the library context.
+ * @param[in] size			- the number of bytes to allocate, already rounded.
+ * @return the allocated memory, or NULL if no memory is left.
+ */
+static void *arena_bump(ctx_t *ctx, size_t size) {
+	arena_t *blk = ctx->arena_blk, *next;
+	size_t need = size + ARENA_ALIGN;
+	uint8_t *p;
+
+	if (blk == NULL || ctx->arena_top + need > blk->size) {
+		next = (blk == NULL ? ctx->arena : blk->next);
+		if (next == NULL || next->size < need) {
+			/* Reserve a new block and link it after the current one. */
+			next = (arena_t *)arena_heap(ROUND(sizeof(arena_t)) +
+					MAX(need, ARENA_SIZE));
+			if (next == NULL) {
+				return NULL;
+			}
+			next->size = MAX(need, ARENA_SIZE);
+			if (blk == NULL) {
+				next->next = ctx->arena;
+				ctx->arena = next;
+			} else {
+				next->next = blk->next;
+				blk->next = next;
+			}
+		}
+		ctx->arena_blk = blk = next;
+		ctx->arena_top = 0;
+	}
+
+	p = DATA(blk) + ctx->arena_top + ARENA_ALIGN;
+	ctx->arena_top += need;
+	/* The lowest bit distinguishes arena memory from heap memory. */
+	HEAD(p) = (size << 1) | 1;
+	return p;
+}
+
+#endif /* ALLOC == ARENA */
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if ALLOC == ARENA
+
+void arena_init(void) {
+	ctx_t *ctx = core_get();
+
+	ctx->arena = ctx->arena_blk = NULL;
+	ctx->arena_top = 0;
+	ctx->arena_mark = NULL;
+}
+
+void arena_clean(void) {
+	ctx_t *ctx = core_get();
+	arena_t *blk;
+
+	while (ctx->arena != NULL) {
+		blk = ctx->arena->next;
+		arena_free(ctx->arena);
+		ctx->arena = blk;
+	}
+	arena_init();
+}
+
+void arena_open(void) {
+	ctx_t *ctx = core_get();
+	arena_t *blk = ctx->arena_blk;
+	size_t top = ctx->arena_top;
+	mark_t *mark;
+
+	mark = (mark_t *)arena_bump(ctx, ROUND(sizeof(mark_t)));
+	if (mark == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	mark->blk = blk;
+	mark->top = top;
+	mark->prev = (mark_t *)ctx->arena_mark;
+	ctx->arena_mark = mark;
+}
+
+void arena_close(void) {
+	ctx_t *ctx = core_get();
+	mark_t *mark = (mark_t *)ctx->arena_mark;
+
+	if (mark != NULL) {
+		/* Everything allocated after the mark, including it, is released. */
+		ctx->arena_blk = mark->blk;
+		ctx->arena_top = mark->top;
+		ctx->arena_mark = mark->prev;
+	}
+}
+
+void *arena_get(size_t size) {
+	ctx_t *ctx = core_get();
+	uint8_t *p;
+
+	size = ROUND(size);
+	if (ctx->arena_mark != NULL) {
+		return arena_bump(ctx, size);
+	}
+
+	/* Outside a scope, fall back to the heap. */
+	p = (uint8_t *)arena_heap(size + ARENA_ALIGN);
+	if (p == NULL) {
+		return NULL;
+	}
+	p += ARENA_ALIGN;
+	HEAD(p) = (size << 1);
+	return p;
+}
+
+void *arena_grow(void *a, size_t size) {
+	size_t old;
+	uint8_t *p;
+
+	if (a == NULL) {
+		return arena_get(size);
+	}
+
+	old = HEAD(a) >> 1;
+	size = ROUND(size);
+	if (size <= old) {
+		return a;
+	}
+
+	/*
+	 * Grown memory always moves to the heap, since the scope that owns the
+	 * object may enclose the current one. It is freed by arena_put().
+	 */
+	p = (uint8_t *)arena_heap(size + ARENA_ALIGN);
+	if (p != NULL) {
+		p += ARENA_ALIGN;
+		HEAD(p) = (size << 1);
+		memcpy(p, a, old);
+		arena_put(a);
+	}
+	return p;
+}
+
+void arena_put(void *a) {
+	ctx_t *ctx = core_get();
+	size_t size;
+
+	if (a == NULL) {
+		return;
+	}
+
+	size = HEAD(a) >> 1;
+	if ((HEAD(a) & 1) == 0) {
+		arena_free((uint8_t *)a - ARENA_ALIGN);
+		return;
+	}
+	/* Only the last allocation can be reclaimed before the scope is closed. */
+	if (ctx->arena_blk != NULL &&
+			(uint8_t *)a + size == DATA(ctx->arena_blk) + ctx->arena_top) {
+		ctx->arena_top -= size + ARENA_ALIGN;
+	}
+}
+
+void arena_unwind(void *mark) {
+	ctx_t *ctx = core_get();
+
+	while (ctx->arena_mark != NULL && ctx->arena_mark != mark) {
+		arena_close();
+	}
+}
+
+#else
+
+void arena_open(void) {
+}
+
+void arena_close(void) {
+}
+
+#endif /* ALLOC == ARENA */
@@ -55,6 +55,8 @@ void conf_print(void) {
 	util_print("** Allocation mode: DYNAMIC\n\n");
 #elif ALLOC == STACK
 	util_print("** Allocation mode: STACK\n\n");
+#elif ALLOC == ARENA
+	util_print("** Allocation mode: ARENA\n\n");
 #elif ALLOC == AUTO
 	util_print("** Allocation mode: AUTO\n\n");
 #endif
@@ -72,11 +72,237 @@ thread ctx_t *core_ctx = NULL;
 #pragma omp threadprivate(first_ctx, core_ctx)
 #endif
 
+/**
+ * Represents a read-only library context shared by many threads.
+ */
+typedef struct {
+	/** The shared parameters and references to precomputation tables. */
+	ctx_t ctx;
+	/** The number of contexts holding a reference to this context. */
+	int refs;
+} shr_t;
+
+/**
+ * The most recently published shared context.
+ */
+static shr_t *shared_ctx = NULL;
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the shared context and all the reference counters.
+ */
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Copies the configured parameters of a library context to the current one,
+ * which must be initialized. Precomputation tables are referenced instead of
+ * copied.
+ *
+ * @param[in] src				- the context to copy the parameters from.
+ * @throw ERR_NO_MEMORY if there is no available memory.
+ */
+static void core_copy(const ctx_t *src) {
+	ctx_t *ctx = core_get();
+
+#ifdef WITH_FB
+	ctx->fb_id = src->fb_id;
+	memcpy(ctx->fb_poly, src->fb_poly, sizeof(fb_st));
+	ctx->fb_pa = src->fb_pa;
+	ctx->fb_pb = src->fb_pb;
+	ctx->fb_pc = src->fb_pc;
+	ctx->fb_na = src->fb_na;
+	ctx->fb_nb = src->fb_nb;
+	ctx->fb_nc = src->fb_nc;
+#if FB_TRC == QUICK || !defined(STRIP)
+	ctx->fb_ta = src->fb_ta;
+	ctx->fb_tb = src->fb_tb;
+	ctx->fb_tc = src->fb_tc;
+#endif
+#if FB_SRT == QUICK || !defined(STRIP)
+	memcpy(ctx->fb_srz, src->fb_srz, sizeof(fb_st));
+#endif
+#if FB_INV == ITOHT || !defined(STRIP)
+	memcpy(ctx->chain, src->chain, sizeof(ctx->chain));
+	ctx->chain_len = src->chain_len;
+#endif
+	ctx->fb_tab = (fb_tab_t *)core_tab_ref(src->fb_tab);
+#endif /* WITH_FB */
+
+#ifdef WITH_EB
+	ctx->eb_id = src->eb_id;
+	memcpy(ctx->eb_a, src->eb_a, sizeof(fb_st));
+	memcpy(ctx->eb_b, src->eb_b, sizeof(fb_st));
+	ctx->eb_opt_a = src->eb_opt_a;
+	ctx->eb_opt_b = src->eb_opt_b;
+	eb_copy(&(ctx->eb_g), (eb_st *)&(src->eb_g));
+	bn_copy(&(ctx->eb_r), (bn_st *)&(src->eb_r));
+	bn_copy(&(ctx->eb_h), (bn_st *)&(src->eb_h));
+#if defined(EB_KBLTZ) && (EB_MUL == LWNAF || !defined(STRIP))
+	bn_copy(&(ctx->eb_vm), (bn_st *)&(src->eb_vm));
+	bn_copy(&(ctx->eb_s0), (bn_st *)&(src->eb_s0));
+	bn_copy(&(ctx->eb_s1), (bn_st *)&(src->eb_s1));
+#endif
+	ctx->eb_is_kbltz = src->eb_is_kbltz;
+#ifdef EB_PRECO
+	ctx->eb_tab = (eb_tab_t *)core_tab_ref(src->eb_tab);
+#endif
+#endif /* WITH_EB */
+
+#ifdef WITH_FP
+	ctx->fp_id = src->fp_id;
+	bn_copy(&(ctx->prime), (bn_st *)&(src->prime));
+#if FP_RDC == MONTY || !defined(STRIP)
+	bn_copy(&(ctx->conv), (bn_st *)&(src->conv));
+	bn_copy(&(ctx->one), (bn_st *)&(src->one));
+#endif
+	ctx->mod8 = src->mod8;
+	ctx->u = src->u;
+	ctx->qnr = src->qnr;
+	ctx->cnr = src->cnr;
+	memcpy(ctx->sps, src->sps, sizeof(ctx->sps));
+	ctx->sps_len = src->sps_len;
+	memcpy(ctx->fp_chains, src->fp_chains, sizeof(ctx->fp_chains));
+#endif /* WITH_FP */
+
+#ifdef WITH_EP
+	ctx->ep_id = src->ep_id;
+	memcpy(ctx->ep_a, src->ep_a, sizeof(fp_st));
+	memcpy(ctx->ep_b, src->ep_b, sizeof(fp_st));
+	ep_copy(&(ctx->ep_g), (ep_st *)&(src->ep_g));
+	bn_copy(&(ctx->ep_r), (bn_st *)&(src->ep_r));
+	bn_copy(&(ctx->ep_h), (bn_st *)&(src->ep_h));
+#if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || !defined(STRIP))
+	memcpy(ctx->beta, src->beta, sizeof(fp_st));
+	for (int i = 0; i < 3; i++) {
+		bn_copy(&(ctx->ep_v1[i]), (bn_st *)&(src->ep_v1[i]));
+		bn_copy(&(ctx->ep_v2[i]), (bn_st *)&(src->ep_v2[i]));
+	}
+#endif
+	ctx->ep_opt_a = src->ep_opt_a;
+	ctx->ep_opt_b = src->ep_opt_b;
+	ctx->ep_is_endom = src->ep_is_endom;
+	ctx->ep_is_super = src->ep_is_super;
+#ifdef EP_PRECO
+	ctx->ep_tab = (ep_tab_t *)core_tab_ref(src->ep_tab);
+#endif
+#endif /* WITH_EP */
+
+#if defined(WITH_EPX) && defined(WITH_PP)
+	ep2_copy(&(ctx->ep2_g), (ep2_st *)&(src->ep2_g));
+	memcpy(ctx->ep2_a, src->ep2_a, sizeof(fp2_st));
+	memcpy(ctx->ep2_b, src->ep2_b, sizeof(fp2_st));
+	bn_copy(&(ctx->ep2_r), (bn_st *)&(src->ep2_r));
+	bn_copy(&(ctx->ep2_h), (bn_st *)&(src->ep2_h));
+	ctx->ep2_is_twist = src->ep2_is_twist;
+#ifdef EP_PRECO
+	ctx->ep2_tab = (ep2_tab_t *)core_tab_ref(src->ep2_tab);
+#endif
+#endif /* WITH_EPX && WITH_PP */
+
+#ifdef WITH_PP
+	memcpy(ctx->fp2_p, src->fp2_p, sizeof(ctx->fp2_p));
+	memcpy(ctx->fp2_p2, src->fp2_p2, sizeof(ctx->fp2_p2));
+	memcpy(ctx->fp2_p3, src->fp2_p3, sizeof(ctx->fp2_p3));
+	memcpy(ctx->fp3_base, src->fp3_base, sizeof(ctx->fp3_base));
+	memcpy(ctx->fp3_p, src->fp3_p, sizeof(ctx->fp3_p));
+	memcpy(ctx->fp3_p2, src->fp3_p2, sizeof(ctx->fp3_p2));
+	memcpy(ctx->fp3_p3, src->fp3_p3, sizeof(ctx->fp3_p3));
+	memcpy(ctx->fp3_p4, src->fp3_p4, sizeof(ctx->fp3_p4));
+	memcpy(ctx->fp3_p5, src->fp3_p5, sizeof(ctx->fp3_p5));
+#endif /* WITH_PP */
+}
+
+/**
+ * Finalizes and frees a shared context no longer referenced.
+ *
+ * @param[in] shr				- the shared context.
+ */
+static void core_drop(shr_t *shr) {
+	ctx_t *ctx = core_get();
+
+	core_set(&(shr->ctx));
+	core_clean();
+	core_set(ctx);
+	free(shr);
+}
+
+/**
+ * Updates the reference counter of a shared context, optionally replacing
+ * the most recently published one.
+ *
+ * @param[in] shr				- the shared context, or NULL for the published one.
+ * @param[in] inc				- the increment to the reference counter.
+ * @param[in] pub				- the flag to publish the shared context.
+ * @return the shared context if still referenced, NULL otherwise.
+ */
+static shr_t *core_ref(shr_t *shr, int inc, int pub) {
+	shr_t *r, *dead = NULL;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&shared_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (relic_shared)
+#endif
+	{
+		if (pub) {
+			shared_ctx = shr;
+		}
+		r = (shr == NULL ? shared_ctx : shr);
+		if (r != NULL) {
+			r->refs += inc;
+			if (r->refs == 0) {
+				if (shared_ctx == r) {
+					shared_ctx = NULL;
+				}
+				dead = r;
+				r = NULL;
+			}
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&shared_lock);
+#endif
+
+	/* Finalizing takes the lock again to release the tables. */
+	if (dead != NULL) {
+		core_drop(dead);
+	}
+	return r;
+}
+
+/**
+ * Updates the reference counter of a precomputation table.
+ *
+ * @param[in] tab				- the table.
+ * @param[in] inc				- the increment to the reference counter.
+ * @return the updated reference counter.
+ */
+static int core_tab_inc(void *tab, int inc) {
+	int *refs = (int *)tab, r;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&shared_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (relic_shared)
+#endif
+	{
+		*refs += inc;
+		r = *refs;
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&shared_lock);
+#endif
+	return r;
+}
+
 int core_init(void) {
 	if (core_ctx == NULL) {
 		core_ctx = &(first_ctx);
 	}
 
+	core_ctx->shared = NULL;
+
 #if defined(CHECK) || defined(TRACE)
 	core_ctx->trace = 0;
 #endif
@@ -95,7 +321,9 @@ int core_init(void) {
 #endif /* CHECK */
 
 #if ALLOC == STATIC
-	core_ctx->next = 0;
+	pool_init();
+#elif ALLOC == ARENA
+	arena_init();
 #endif
 
 #ifdef OVERH
@@ -134,6 +362,10 @@ int core_init(void) {
 }
 
 int core_clean(void) {
+	if (core_ctx->shared != NULL) {
+		core_ref((shr_t *)core_ctx->shared, -1, 0);
+		core_ctx->shared = NULL;
+	}
 	rand_clean();
 #ifdef WITH_FP
 	fp_prime_clean();
@@ -154,6 +386,11 @@ int core_clean(void) {
 	pp_map_clean();
 #endif
 	arch_clean();
+#if ALLOC == STATIC
+	pool_clean();
+#elif ALLOC == ARENA
+	arena_clean();
+#endif
 	core_ctx = NULL;
 	return STS_OK;
 }
@@ -165,3 +402,101 @@ ctx_t *core_get() {
 void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
+
+int core_share(void) {
+	ctx_t *ctx = core_ctx;
+	shr_t *shr;
+	int code = STS_OK;
+
+	if (ctx == NULL) {
+		return STS_ERR;
+	}
+
+	shr = (shr_t *)calloc(1, sizeof(shr_t));
+	if (shr == NULL) {
+		return STS_ERR;
+	}
+
+	/* Build the shared context in its own storage. */
+	core_set(&(shr->ctx));
+	if (core_init() == STS_OK) {
+		TRY {
+			core_copy(ctx);
+		}
+		CATCH_ANY {
+			code = STS_ERR;
+		}
+	} else {
+		code = STS_ERR;
+	}
+	core_set(ctx);
+
+	if (code != STS_OK) {
+		core_drop(shr);
+		return STS_ERR;
+	}
+
+	/* The publishing context holds the first reference. */
+	shr->refs = 1;
+	core_ref(shr, 0, 1);
+
+	if (ctx->shared != NULL) {
+		core_ref((shr_t *)ctx->shared, -1, 0);
+	}
+	ctx->shared = shr;
+	return STS_OK;
+}
+
+int core_attach(void) {
+	shr_t *shr;
+	int code = STS_OK;
+
+	shr = core_ref(NULL, 1, 0);
+	if (shr == NULL) {
+		return STS_ERR;
+	}
+
+	if (core_init() == STS_OK) {
+		TRY {
+			core_copy(&(shr->ctx));
+		}
+		CATCH_ANY {
+			code = STS_ERR;
+		}
+	} else {
+		code = STS_ERR;
+	}
+
+	core_ref(shr, -1, 0);
+	return code;
+}
+
+void *core_tab_own(void *tab, size_t size) {
+	int *refs;
+
+	if (tab != NULL) {
+		if (core_tab_inc(tab, 0) == 1) {
+			return tab;
+		}
+		core_tab_free(tab);
+	}
+
+	refs = (int *)calloc(1, size);
+	if (refs != NULL) {
+		*refs = 1;
+	}
+	return refs;
+}
+
+void *core_tab_ref(void *tab) {
+	if (tab != NULL) {
+		core_tab_inc(tab, 1);
+	}
+	return tab;
+}
+
+void core_tab_free(void *tab) {
+	if (tab != NULL && core_tab_inc(tab, -1) == 0) {
+		free(tab);
+	}
+}
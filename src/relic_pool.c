@@ -40,45 +40,170 @@
 #include "relic_bn.h"
 #include "relic_pool.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if ALLOC == STATIC && defined(SHARE)
+
+/**
+ * The static pool of digit vectors shared by all threads.
+ */
+static pool_t pool_share[POOL_SIZE];
+
+/**
+ * The links of the stack of free digit vectors, one per pool element.
+ */
+static int pool_link[POOL_SIZE];
+
+/**
+ * The top of the stack of free digit vectors. The lower half stores the
+ * position of the top element plus one and the upper half stores a counter
+ * incremented on every update to prevent the ABA problem.
+ */
+static uint64_t pool_head = 0;
+
+/**
+ * The number of digit vectors in the pool ever handed out.
+ */
+static int pool_used = 0;
+
+/**
+ * Removes an element from the shared stack of free digit vectors.
+ *
+ * @returns the position of the element, or POOL_EMPTY if the pool is empty.
+ */
+static int pool_pop(void) {
+	uint64_t h, t;
+	int r;
+
+	h = __atomic_load_n(&pool_head, __ATOMIC_ACQUIRE);
+	do {
+		r = (int)(h & 0xFFFFFFFF) - 1;
+		if (r == POOL_EMPTY) {
+			/* Take a digit vector that was never used before. */
+			if (__atomic_load_n(&pool_used, __ATOMIC_RELAXED) >= POOL_SIZE) {
+				return POOL_EMPTY;
+			}
+			r = __atomic_fetch_add(&pool_used, 1, __ATOMIC_RELAXED);
+			return (r < POOL_SIZE ? r : POOL_EMPTY);
+		}
+		t = (((h >> 32) + 1) << 32);
+		t |= (uint32_t)(__atomic_load_n(&pool_link[r], __ATOMIC_RELAXED) + 1);
+	} while (!__atomic_compare_exchange_n(&pool_head, &h, t, 1, __ATOMIC_ACQ_REL,
+					__ATOMIC_ACQUIRE));
+	return r;
+}
+
+/**
+ * Inserts an element in the shared stack of free digit vectors.
+ *
+ * @param[in] r			- the position of the element.
+ */
+static void pool_push(int r) {
+	uint64_t h, t;
+
+	h = __atomic_load_n(&pool_head, __ATOMIC_RELAXED);
+	do {
+		__atomic_store_n(&pool_link[r], (int)(h & 0xFFFFFFFF) - 1,
+				__ATOMIC_RELAXED);
+		t = (((h >> 32) + 1) << 32) | (uint32_t)(r + 1);
+	} while (!__atomic_compare_exchange_n(&pool_head, &h, t, 1, __ATOMIC_RELEASE,
+					__ATOMIC_RELAXED));
+}
+
+#endif /* ALLOC == STATIC && SHARE */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 #if ALLOC == STATIC
 
+#ifdef SHARE
+
+void pool_init(void) {
+	core_get()->count = 0;
+}
+
+void pool_clean(void) {
+	ctx_t *ctx = core_get();
+
+	while (ctx->count > 0) {
+		pool_push(ctx->magaz[--ctx->count][DV_DIGS]);
+	}
+}
+
 dig_t *pool_get(void) {
-	int i, r;
+	int r;
 	ctx_t *ctx = core_get();
 
-	if (ctx->next == POOL_EMPTY) {
-		return NULL;
+	if (ctx->count == 0) {
+		/* Refill half of the magazine from the shared pool. */
+		while (ctx->count < POOL_MAGAZ / 2) {
+			r = pool_pop();
+			if (r == POOL_EMPTY) {
+				break;
+			}
+			pool_share[r].elem[DV_DIGS] = r;
+			ctx->magaz[ctx->count++] = pool_share[r].elem;
+		}
+		if (ctx->count == 0) {
+			return NULL;
+		}
 	}
+	return ctx->magaz[--ctx->count];
+}
 
-	/** Allocate a free element. */
-	r = ctx->next;
-	ctx->pool[r].state = POOL_USED;
+void pool_put(dig_t *a) {
+	ctx_t *ctx = core_get();
 
-	/* Search for a new free element. */
-	for (i = (r + 1) % POOL_SIZE; i != r; i = (i + 1) % POOL_SIZE) {
-		if (ctx->pool[i].state == POOL_FREE) {
-			break;
+	if (ctx->count == POOL_MAGAZ) {
+		/* Return half of the magazine to the shared pool. */
+		while (ctx->count > POOL_MAGAZ / 2) {
+			pool_push(ctx->magaz[--ctx->count][DV_DIGS]);
 		}
 	}
-	if (i == r) {
-		ctx->next = POOL_EMPTY;
+	ctx->magaz[ctx->count++] = a;
+}
+
+#else
+
+void pool_init(void) {
+	ctx_t *ctx = core_get();
+
+	ctx->next = POOL_EMPTY;
+	ctx->used = 0;
+}
+
+void pool_clean(void) {
+}
+
+dig_t *pool_get(void) {
+	int r;
+	ctx_t *ctx = core_get();
+
+	if (ctx->next != POOL_EMPTY) {
+		/* Free elements store the position of the next one in the stack. */
+		r = ctx->next;
+		ctx->next = ctx->pool[r].elem[0];
 	} else {
-		ctx->next = i;
+		if (ctx->used == POOL_SIZE) {
+			return NULL;
+		}
+		r = ctx->used++;
 	}
 	ctx->pool[r].elem[DV_DIGS] = r;
 	return (ctx->pool[r].elem);
 }
 
 void pool_put(dig_t *a) {
-	int pos = a[DV_DIGS];
 	ctx_t *ctx = core_get();
 
-	ctx->pool[pos].state = POOL_FREE;
-	ctx->next = pos;
+	a[0] = ctx->next;
+	ctx->next = a[DV_DIGS];
 }
 
+#endif /* SHARE */
+
 #endif /* ALLOC == STATIC */
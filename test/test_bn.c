@@ -535,6 +535,49 @@ static int multiplication(void) {
 		TEST_END;
 #endif
 
+#if BN_MUL == ADAPT || BN_SQR == ADAPT || !defined(STRIP)
+		TEST_BEGIN("toom-3 multiplication is correct") {
+			bn_rand(a, BN_NEG, BN_BITS / 2);
+			bn_rand(b, BN_POS, BN_BITS / 2);
+			bn_mul(c, a, b);
+			bn_mul_toom3(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+			bn_rand(b, BN_POS, BN_BITS / 5);
+			bn_mul(c, a, b);
+			bn_mul_toom3(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+			bn_mul(c, a, a);
+			bn_mul_toom3(d, a, a);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("ntt multiplication is correct") {
+			bn_rand(a, BN_NEG, BN_BITS / 2);
+			bn_rand(b, BN_POS, BN_BITS / 2);
+			bn_mul(c, a, b);
+			bn_mul_ntt(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+			bn_rand(b, BN_POS, BN_BITS / 5);
+			bn_mul(c, a, b);
+			bn_mul_ntt(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+			bn_mul(c, a, a);
+			bn_mul_ntt(d, a, a);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("adaptive multiplication is correct") {
+			bn_rand(a, BN_POS, BN_BITS / 2);
+			bn_rand(b, BN_NEG, BN_BITS / 2);
+			bn_mul(c, a, b);
+			bn_mul_adapt(d, a, b);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+		}
+		TEST_END;
+#endif
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -597,6 +640,15 @@ static int squaring(void) {
 		} TEST_END;
 #endif
 
+#if BN_SQR == ADAPT || !defined(STRIP)
+		TEST_BEGIN("adaptive squaring is correct") {
+			bn_rand(a, BN_POS, BN_BITS / 2);
+			bn_sqr(b, a);
+			bn_sqr_adapt(c, a);
+			TEST_ASSERT(bn_cmp(b, c) == CMP_EQ, end);
+		} TEST_END;
+#endif
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -899,6 +951,24 @@ static int reduction(void) {
 		TEST_END;
 #endif
 
+#if defined(CPUID) && ARCH == X64
+		TEST_BEGIN("montgomery kernels selected at run time are correct") {
+			int ext = arch_get_ext();
+			bn_rand(a, BN_POS, BN_BITS - BN_DIGIT / 2);
+			bn_rand(b, BN_POS, BN_BITS / 2);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			bn_mod_pre_monty(e, b);
+			arch_set_ext(0);
+			bn_mod_monty(c, a, b, e);
+			arch_set_ext(ext);
+			bn_mod_monty(d, a, b, e);
+			TEST_ASSERT(bn_cmp(c, d) == CMP_EQ, end);
+		}
+		TEST_END;
+#endif
+
 #if BN_MOD == PMERS || !defined(STRIP)
 		TEST_BEGIN("pseudo-mersenne reduction is correct") {
 			bn_rand(a, BN_POS, BN_BITS);
@@ -932,16 +1002,35 @@ static int reduction(void) {
 
 static int exponentiation(void) {
 	int code = STS_ERR;
-	bn_t a, b, p;
+	bn_t a, b, c, p, t[BN_TABLE], u[4], v[4];
+	bn_mont_t ctx;
 
+	bn_mont_null(ctx);
 	bn_null(a);
 	bn_null(b);
+	bn_null(c);
 	bn_null(p);
+	for (int i = 0; i < BN_TABLE; i++) {
+		bn_null(t[i]);
+	}
+	for (int i = 0; i < 4; i++) {
+		bn_null(u[i]);
+		bn_null(v[i]);
+	}
 
 	TRY {
 		bn_new(a);
 		bn_new(b);
+		bn_new(c);
 		bn_new(p);
+		for (int i = 0; i < BN_TABLE; i++) {
+			bn_new(t[i]);
+		}
+		for (int i = 0; i < 4; i++) {
+			bn_new(u[i]);
+			bn_new(v[i]);
+		}
+		bn_mont_new(ctx);
 
 #if BN_MOD != PMERS
 		bn_gen_prime(p, BN_BITS);
@@ -1001,6 +1090,129 @@ static int exponentiation(void) {
 		TEST_END;
 #endif
 
+		TEST_BEGIN("constant-time modular exponentiation is correct") {
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_mod(a, a, p);
+			bn_copy(b, a);
+			bn_mxp_consttime(b, b, p, p);
+			TEST_ASSERT(bn_cmp(a, b) == CMP_EQ, end);
+			bn_rand(c, BN_POS, BN_BITS / 4);
+			bn_mxp_consttime(b, a, c, p);
+			bn_mxp(c, a, c, p);
+			TEST_ASSERT(bn_cmp(c, b) == CMP_EQ, end);
+			bn_zero(c);
+			bn_mxp_consttime(b, a, c, p);
+			TEST_ASSERT(bn_cmp_dig(b, 1) == CMP_EQ, end);
+			/* Bases out of range are reduced first. */
+			bn_rand(c, BN_POS, BN_BITS / 4);
+			bn_mxp(b, a, c, p);
+			bn_add(a, a, p);
+			bn_lsh(a, a, BN_DIGIT);
+			bn_set_2b(u[0], BN_DIGIT);
+			bn_mxp(u[0], u[0], c, p);
+			bn_mul(b, b, u[0]);
+			bn_mod(b, b, p);
+			bn_mxp_consttime(u[0], a, c, p);
+			TEST_ASSERT(bn_cmp(u[0], b) == CMP_EQ, end);
+			bn_neg(a, a);
+			bn_mxp_consttime(u[0], a, c, p);
+			bn_mod(a, a, p);
+			if (bn_sign(a) == BN_NEG) {
+				bn_add(a, a, p);
+			}
+			bn_mxp(b, a, c, p);
+			TEST_ASSERT(bn_cmp(u[0], b) == CMP_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("fixed-base modular exponentiation is correct") {
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_mod(a, a, p);
+			bn_mxp_pre(t, a, BN_BITS, p);
+			bn_mxp_fix(b, (const bn_t *)t, p, BN_BITS, p);
+			TEST_ASSERT(bn_cmp(a, b) == CMP_EQ, end);
+			bn_rand(c, BN_POS, BN_BITS / 2);
+			bn_mxp_fix(b, (const bn_t *)t, c, BN_BITS, p);
+			bn_mxp(c, a, c, p);
+			TEST_ASSERT(bn_cmp(c, b) == CMP_EQ, end);
+			bn_zero(c);
+			bn_mxp_fix(b, (const bn_t *)t, c, BN_BITS, p);
+			TEST_ASSERT(bn_cmp_dig(b, 1) == CMP_EQ, end);
+			bn_mxp_pre(t, a, BN_BITS / 2, p);
+			bn_rand(c, BN_POS, BN_BITS / 2);
+			bn_mxp_fix(b, (const bn_t *)t, c, BN_BITS / 2, p);
+			bn_mxp(c, a, c, p);
+			TEST_ASSERT(bn_cmp(c, b) == CMP_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("simultaneous modular exponentiation is correct") {
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_mod(a, a, p);
+			bn_rand(b, BN_POS, BN_BITS);
+			bn_mod(b, b, p);
+			bn_rand(u[0], BN_POS, BN_BITS);
+			bn_rand(u[1], BN_POS, BN_BITS / 2);
+			bn_mxp_sim(c, a, u[0], b, u[1], p);
+			bn_mxp(a, a, u[0], p);
+			bn_mxp(b, b, u[1], p);
+			bn_mul(a, a, b);
+			bn_mod(a, a, p);
+			TEST_ASSERT(bn_cmp(a, c) == CMP_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("simultaneous modular exponentiation of many bases is correct") {
+			for (int j = 1; j <= 4; j++) {
+				bn_set_dig(a, 1);
+				for (int i = 0; i < j; i++) {
+					bn_rand(u[i], BN_POS, BN_BITS);
+					bn_mod(u[i], u[i], p);
+					bn_rand(v[i], BN_POS, BN_BITS >> i);
+					bn_mxp(b, u[i], v[i], p);
+					bn_mul(a, a, b);
+					bn_mod(a, a, p);
+				}
+				bn_mxp_sim_lot(c, (const bn_t *)u, (const bn_t *)v, p, j);
+				TEST_ASSERT(bn_cmp(a, c) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+
+#if BN_MOD == MONTY || !defined(STRIP)
+		TEST_BEGIN("montgomery context arithmetic is correct") {
+			bn_mont_set(ctx, p);
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_mod(a, a, p);
+			bn_rand(b, BN_POS, BN_BITS);
+			bn_mod(b, b, p);
+			bn_mont_conv(u[0], a, ctx);
+			bn_mont_conv(u[1], b, ctx);
+			bn_mont_back(c, u[0], ctx);
+			TEST_ASSERT(bn_cmp(a, c) == CMP_EQ, end);
+			bn_mont_mul(u[2], u[0], u[1], ctx);
+			bn_mont_back(u[2], u[2], ctx);
+			bn_mul(c, a, b);
+			bn_mod(c, c, p);
+			TEST_ASSERT(bn_cmp(u[2], c) == CMP_EQ, end);
+			bn_mont_sqr(u[2], u[0], ctx);
+			bn_mont_back(u[2], u[2], ctx);
+			bn_sqr(c, a);
+			bn_mod(c, c, p);
+			TEST_ASSERT(bn_cmp(u[2], c) == CMP_EQ, end);
+			bn_mont_mxp(u[2], u[0], p, ctx);
+			TEST_ASSERT(bn_cmp(u[2], u[0]) == CMP_EQ, end);
+			bn_rand(v[0], BN_POS, BN_BITS / 2);
+			bn_mont_mxp(u[2], u[0], v[0], ctx);
+			bn_mont_back(u[2], u[2], ctx);
+			bn_mxp(c, a, v[0], p);
+			TEST_ASSERT(bn_cmp(u[2], c) == CMP_EQ, end);
+			bn_mont_mxp_consttime(u[2], a, v[0], ctx);
+			TEST_ASSERT(bn_cmp(u[2], c) == CMP_EQ, end);
+		}
+		TEST_END;
+#endif
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1009,7 +1221,16 @@ static int exponentiation(void) {
   end:
 	bn_free(a);
 	bn_free(b);
+	bn_free(c);
 	bn_free(p);
+	for (int i = 0; i < BN_TABLE; i++) {
+		bn_free(t[i]);
+	}
+	for (int i = 0; i < 4; i++) {
+		bn_free(u[i]);
+		bn_free(v[i]);
+	}
+	bn_mont_free(ctx);
 	return code;
 }
 
@@ -1126,6 +1347,30 @@ static int gcd(void) {
 		} TEST_END;
 #endif
 
+		TEST_BEGIN("constant-time modular inversion is correct") {
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_rand(b, BN_POS, BN_BITS);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			bn_gcd_ext(c, d, NULL, a, b);
+			if (bn_cmp_dig(c, 1) == CMP_EQ) {
+				bn_mod_inv_const(e, a, b);
+				bn_mul(c, e, a);
+				bn_mod(c, c, b);
+				TEST_ASSERT(bn_cmp_dig(c, 1) == CMP_EQ, end);
+				bn_mod(d, d, b);
+				if (bn_sign(d) == BN_NEG) {
+					bn_add(d, d, b);
+				}
+				TEST_ASSERT(bn_cmp(d, e) == CMP_EQ, end);
+				bn_neg(a, a);
+				bn_mod_inv_const(f, a, b);
+				bn_add(f, f, e);
+				TEST_ASSERT(bn_cmp(f, b) == CMP_EQ, end);
+			}
+		} TEST_END;
+
 		TEST_BEGIN("midway extended greatest common divisor is correct") {
 			bn_rand(a, BN_POS, BN_BITS);
 			bn_rand(b, BN_POS, BN_BITS);
@@ -1497,12 +1742,14 @@ static int digit(void) {
 
 static int prime(void) {
 	int code = STS_ERR;
-	bn_t p;
+	bn_t p, q;
 
 	bn_null(p);
+	bn_null(q);
 
 	TRY {
 		bn_new(p);
+		bn_new(q);
 
 		TEST_ONCE("prime generation is consistent") {
 			bn_gen_prime(p, BN_BITS);
@@ -1533,6 +1780,14 @@ static int prime(void) {
 		} TEST_END;
 #endif
 
+		TEST_ONCE("parallel prime generation is consistent") {
+			bn_gen_prime_par(p, q, BN_BITS);
+			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			TEST_ASSERT(bn_is_prime(q) == 1, end);
+			TEST_ASSERT(bn_bits(p) == BN_BITS && bn_bits(q) == BN_BITS, end);
+			TEST_ASSERT(bn_cmp(p, q) != CMP_EQ, end);
+		} TEST_END;
+
 		bn_gen_prime(p, BN_BITS);
 
 		TEST_ONCE("basic prime testing is correct") {
@@ -1553,6 +1808,7 @@ static int prime(void) {
 	code = STS_OK;
   end:
 	bn_free(p);
+	bn_free(q);
 	return code;
 }
 
@@ -34,6 +34,49 @@
 #include "relic.h"
 #include "relic_test.h"
 
+#if ALLOC == STATIC && defined(MULTI)
+
+/**
+ * Gets and returns digit vectors from the static pool, checking that no other
+ * thread writes to them in between.
+ *
+ * @param[in,out] arg			- the pointer to the result code.
+ * @return NULL.
+ */
+static void *pool_thread(void *arg) {
+	int *code = (int *)arg;
+	dig_t *v[2 * POOL_MAGAZ], t;
+	int i, j, init = (core_get() == NULL);
+
+	if (init) {
+		core_init();
+	}
+	t = (dig_t)(uintptr_t)&t;
+	for (j = 0; j < TESTS; j++) {
+		for (i = 0; i < 2 * POOL_MAGAZ; i++) {
+			v[i] = pool_get();
+			if (v[i] == NULL) {
+				*code = STS_ERR;
+				break;
+			}
+			v[i][0] = t;
+			v[i][1] = i;
+		}
+		while (--i >= 0) {
+			if (v[i][0] != t || v[i][1] != (dig_t)i) {
+				*code = STS_ERR;
+			}
+			pool_put(v[i]);
+		}
+	}
+	if (init) {
+		core_clean();
+	}
+	return NULL;
+}
+
+#endif
+
 int main(void) {
 	int code = STS_ERR;
 
@@ -69,9 +112,187 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+#if defined(WITH_EP) && defined(EP_PRECO)
+	TEST_ONCE("attaching to a shared library context is correct") {
+		ctx_t new_ctx, *old_ctx;
+		ep_t p, q;
+		bn_t k;
+
+		ep_null(p);
+		ep_null(q);
+		bn_null(k);
+		ep_new(p);
+		ep_new(q);
+		bn_new(k);
+
+		ep_param_set_any();
+		bn_rand(k, BN_POS, FP_BITS);
+		ep_mul_gen(p, k);
+		TEST_ASSERT(core_share() == STS_OK, end);
+		/* Backup the old context. */
+		old_ctx = core_get();
+		/* Attach a fresh context, as a new thread would. */
+		memset(&new_ctx, 0, sizeof(ctx_t));
+		core_set(&new_ctx);
+		TEST_ASSERT(core_attach() == STS_OK, end);
+		TEST_ASSERT(ep_param_get() == old_ctx->ep_id, end);
+		/* The table is referenced, not copied. */
+		TEST_ASSERT(new_ctx.ep_tab == old_ctx->ep_tab, end);
+		ep_mul_gen(q, k);
+		TEST_ASSERT(ep_cmp(p, q) == CMP_EQ, end);
+		/* Changing parameters must not touch the shared tables. */
+		ep_param_set_any();
+		TEST_ASSERT(new_ctx.ep_tab != old_ctx->ep_tab, end);
+		ep_mul_gen(q, k);
+		TEST_ASSERT(ep_cmp(p, q) == CMP_EQ, end);
+		core_clean();
+		/* And restore the original context. */
+		core_set(old_ctx);
+		ep_mul_gen(q, k);
+		TEST_ASSERT(ep_cmp(p, q) == CMP_EQ, end);
+
+		ep_free(p);
+		ep_free(q);
+		bn_free(k);
+	} TEST_END;
+#endif
+
+#if ALLOC == ARENA
+	TEST_ONCE("arena scopes are consistent") {
+		void *a, *b, *c;
+		bn_t k, t;
+
+		bn_null(k);
+		bn_null(t);
+		bn_new(k);
+
+		arena_open();
+		a = arena_get(100);
+		arena_open();
+		b = arena_get(100);
+		arena_close();
+		/* Memory from a closed scope is reused. */
+		arena_open();
+		c = arena_get(100);
+		arena_close();
+		TEST_ASSERT(a != NULL && b != NULL && b == c, end);
+		c = arena_get(100);
+		/* The last allocation is reclaimed immediately. */
+		arena_put(c);
+		TEST_ASSERT(arena_get(100) == c, end);
+		arena_close();
+		arena_open();
+		TEST_ASSERT(arena_get(100) == a, end);
+		arena_close();
+
+		/* Objects created outside a scope survive it, even if grown. */
+		arena_open();
+		bn_set_2b(k, 2 * BN_BITS);
+		arena_close();
+		arena_open();
+		bn_new(t);
+		bn_set_2b(t, BN_BITS - 1);
+		bn_free(t);
+		arena_close();
+		TEST_ASSERT(bn_bits(k) == 2 * BN_BITS + 1, end);
+
+		bn_free(k);
+	} TEST_END;
+
+#ifdef CHECK
+	TEST_ONCE("arena scopes are closed by errors") {
+		void *a, *b;
+
+		arena_open();
+		a = arena_get(100);
+		arena_close();
+		TRY {
+			arena_open();
+			arena_get(100);
+			/* Mimic a function that rethrows without closing its scope. */
+			TRY {
+				arena_open();
+				arena_get(100);
+				THROW(ERR_NO_VALID);
+			}
+			CATCH_ANY {
+				THROW(ERR_CAUGHT);
+			}
+			arena_close();
+		}
+		CATCH_ANY {
+			err_get_code();
+		}
+		TEST_ASSERT(core_get()->arena_mark == NULL, end);
+		arena_open();
+		b = arena_get(100);
+		arena_close();
+		TEST_ASSERT(a == b, end);
+	} TEST_END;
+#endif
+#endif
+
+#if ALLOC == STATIC
+	TEST_ONCE("the static pool is consistent") {
+		static dig_t *v[POOL_SIZE];
+		int i, j, n;
+
+		/* Exhaust the pool and return every element. */
+		for (n = 0; n < POOL_SIZE && (v[n] = pool_get()) != NULL; n++) {
+			v[n][0] = n;
+		}
+		TEST_ASSERT(n > 0 && pool_get() == NULL, end);
+		for (i = 0; i < n; i++) {
+			TEST_ASSERT(v[i][0] == (dig_t)i, end);
+		}
+		for (i = 0; i < n; i++) {
+			pool_put(v[i]);
+		}
+		/* The same number of elements must be available again. */
+		for (j = 0; j < n && (v[j] = pool_get()) != NULL; j++);
+		TEST_ASSERT(j == n && pool_get() == NULL, end);
+		for (i = 0; i < n; i++) {
+			pool_put(v[i]);
+		}
+	} TEST_END;
+#endif
+
 	code = STS_OK;
 
-#ifdef MULTI
+#if ALLOC == STATIC && defined(SHARE)
+	TEST_ONCE("the shared pool is consistent across contexts") {
+		static dig_t *v[POOL_SIZE];
+		ctx_t new_ctx, *old_ctx;
+		int i, j, n;
+
+		old_ctx = core_get();
+		for (n = 0; n < POOL_SIZE && (v[n] = pool_get()) != NULL; n++);
+		TEST_ASSERT(n > 0, end);
+		/* Return every element from another context. */
+		core_set(&new_ctx);
+		pool_init();
+		for (i = 0; i < n; i++) {
+			pool_put(v[i]);
+		}
+		/* Elements cached by that context go back to the shared pool. */
+		pool_clean();
+		core_set(old_ctx);
+		for (j = 0; j < n && (v[j] = pool_get()) != NULL; j++);
+		TEST_ASSERT(j == n && pool_get() == NULL, end);
+		/* No element can be handed out twice. */
+		for (i = 0; i < n; i++) {
+			v[i][0] = i;
+		}
+		for (i = 0; i < n; i++) {
+			TEST_ASSERT(v[i][0] == (dig_t)i, end);
+		}
+		for (i = 0; i < n; i++) {
+			pool_put(v[i]);
+		}
+	} TEST_END;
+#endif
+
+#if MULTI == OPENMP
 	TEST_ONCE("library context is thread-safe") {
 	omp_set_num_threads(CORES);
 #pragma omp parallel shared(code)
@@ -93,6 +314,27 @@ int main(void) {
 	} TEST_END;
 #endif
 
+#if ALLOC == STATIC && defined(MULTI)
+	TEST_ONCE("the static pool is thread-safe") {
+#if MULTI == OPENMP
+		omp_set_num_threads(CORES);
+#pragma omp parallel shared(code)
+		pool_thread(&code);
+#elif MULTI == PTHREAD
+		pthread_t thread[CORES];
+		int i;
+
+		for (i = 0; i < CORES; i++) {
+			pthread_create(&thread[i], NULL, pool_thread, &code);
+		}
+		for (i = 0; i < CORES; i++) {
+			pthread_join(thread[i], NULL);
+		}
+#endif
+		TEST_ASSERT(code == STS_OK, end);
+	} TEST_END;
+#endif
+
 	util_banner("All tests have passed.\n", 0);
 	  end:
 	core_clean();
@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "relic.h"
 #include "relic_test.h"
@@ -138,6 +139,47 @@ static int rsa(void) {
 					end);
 			TEST_ASSERT(cp_rsa_ver(out, ol, h, MD_LEN, 1, pub) == 1, end);
 		} TEST_END;
+
+		TEST_BEGIN("batch rsa encryption/decryption is correct") {
+			uint8_t bi[4][10], bo[4][BN_BITS / 8 + 1], *po[4];
+			int li[4], lo[4];
+
+			TEST_ASSERT(result == STS_OK, end);
+			for (int i = 0; i < 4; i++) {
+				po[i] = bo[i];
+				li[i] = 10;
+				lo[i] = BN_BITS / 8 + 1;
+				rand_bytes(bi[i], li[i]);
+				TEST_ASSERT(cp_rsa_enc(bo[i], &lo[i], bi[i], li[i], pub) ==
+						STS_OK, end);
+			}
+			TEST_ASSERT(cp_rsa_dec_batch(po, lo, po, lo, 4, prv) == STS_OK,
+					end);
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(lo[i] == li[i], end);
+				TEST_ASSERT(memcmp(bi[i], bo[i], li[i]) == 0, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("batch rsa signature/verification is correct") {
+			uint8_t bi[4][10], bo[4][BN_BITS / 8 + 1], *pi[4], *po[4];
+			int li[4], lo[4];
+
+			TEST_ASSERT(result == STS_OK, end);
+			for (int i = 0; i < 4; i++) {
+				pi[i] = bi[i];
+				po[i] = bo[i];
+				li[i] = 10;
+				lo[i] = BN_BITS / 8 + 1;
+				rand_bytes(bi[i], li[i]);
+			}
+			TEST_ASSERT(cp_rsa_sig_batch(po, lo, pi, li, 4, 0, prv) == STS_OK,
+					end);
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(cp_rsa_ver(bo[i], lo[i], bi[i], li[i], 0, pub) == 1,
+						end);
+			}
+		} TEST_END;
 #endif
 	} CATCH_ANY {
 		ERROR(end);
@@ -779,23 +821,74 @@ static int sokaka(void) {
 static int bls(void) {
 	int code = STS_ERR;
 	bn_t d;
-	g1_t s;
-	g2_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	g1_t s, a, t[3];
+	g2_t q, p[3];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, b[3][5];
+	uint8_t *ms[3] = { b[0], b[1], b[2] };
+	int ls[3] = { 5, 5, 5 };
 
 	bn_null(d);
 	g1_null(s);
+	g1_null(a);
 	g2_null(q);
+	for (int i = 0; i < 3; i++) {
+		g1_null(t[i]);
+		g2_null(p[i]);
+	}
 
 	TRY {
 		bn_new(d);
 		g1_new(s);
+		g1_new(a);
 		g2_new(q);
+		for (int i = 0; i < 3; i++) {
+			g1_new(t[i]);
+			g2_new(p[i]);
+		}
 
 		TEST_BEGIN("boneh-lynn-schacham short signature is correct") {
 			TEST_ASSERT(cp_bls_gen(d, q) == STS_OK, end);
 			TEST_ASSERT(cp_bls_sig(s, m, sizeof(m), d) == STS_OK, end);
 			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 0, end);
+			m[0] ^= 1;
+		}
+		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham aggregate signature is correct") {
+			for (int i = 0; i < 3; i++) {
+				rand_bytes(b[i], ls[i]);
+				TEST_ASSERT(cp_bls_gen(d, p[i]) == STS_OK, end);
+				TEST_ASSERT(cp_bls_sig(t[i], b[i], ls[i], d) == STS_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg(a, t, 3) == STS_OK, end);
+			TEST_ASSERT(cp_bls_ver_agg(a, ms, ls, p, 3) == 1, end);
+			b[1][0] ^= 1;
+			TEST_ASSERT(cp_bls_ver_agg(a, ms, ls, p, 3) == 0, end);
+			/* Aggregates over repeated messages must be rejected. */
+			memcpy(b[1], b[0], ls[0]);
+			for (int i = 0; i < 3; i++) {
+				TEST_ASSERT(cp_bls_gen(d, p[i]) == STS_OK, end);
+				TEST_ASSERT(cp_bls_sig(t[i], b[i], ls[i], d) == STS_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg(a, t, 3) == STS_OK, end);
+			TEST_ASSERT(cp_bls_ver_agg(a, ms, ls, p, 3) == 0, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham batch verification is correct") {
+			for (int i = 0; i < 3; i++) {
+				rand_bytes(b[i], ls[i]);
+				TEST_ASSERT(cp_bls_gen(d, p[i]) == STS_OK, end);
+				TEST_ASSERT(cp_bls_sig(t[i], b[i], ls[i], d) == STS_OK, end);
+			}
+			TEST_ASSERT(cp_bls_ver_batch(t, ms, ls, p, 3) == 1, end);
+			/* Swapping two signatures must be detected. */
+			g1_copy(s, t[0]);
+			g1_copy(t[0], t[1]);
+			g1_copy(t[1], s);
+			TEST_ASSERT(cp_bls_ver_batch(t, ms, ls, p, 3) == 0, end);
 		}
 		TEST_END;
 	}
@@ -807,7 +900,12 @@ static int bls(void) {
   end:
 	bn_free(d);
 	g1_free(s);
+	g1_free(a);
 	g2_free(q);
+	for (int i = 0; i < 3; i++) {
+		g1_free(t[i]);
+		g2_free(p[i]);
+	}
 	return code;
 }
 
@@ -851,8 +851,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = STS_ERR;
-	bn_t n, k, l;
-	eb_t p, q, r;
+	bn_t n, k, l, _k[64];
+	eb_t p, q, r, _p[64];
 
 	bn_null(n);
 	bn_null(k);
@@ -860,6 +860,10 @@ static int simultaneous(void) {
 	eb_null(p);
 	eb_null(q);
 	eb_null(r);
+	for (int i = 0; i < 64; i++) {
+		bn_null(_k[i]);
+		eb_null(_p[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -868,6 +872,10 @@ static int simultaneous(void) {
 		eb_new(p);
 		eb_new(q);
 		eb_new(r);
+		for (int i = 0; i < 64; i++) {
+			bn_new(_k[i]);
+			eb_new(_p[i]);
+		}
 
 		eb_curve_get_ord(n);
 
@@ -944,6 +952,26 @@ static int simultaneous(void) {
 			eb_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(eb_cmp(q, r) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			for (int j = 2; j <= 64; j += 62) {
+				eb_set_infty(q);
+				for (int i = 0; i < j; i++) {
+					bn_rand(_k[i], BN_POS, bn_bits(n));
+					bn_mod(_k[i], _k[i], n);
+					eb_rand(_p[i]);
+					eb_mul(r, _p[i], _k[i]);
+					if (i == 1) {
+						bn_neg(_k[i], _k[i]);
+						eb_neg(r, r);
+					}
+					eb_add(q, q, r);
+				}
+				eb_norm(q, q);
+				eb_mul_sim_lot(r, (const eb_t *)_p, (const bn_t *)_k, j);
+				TEST_ASSERT(eb_cmp(q, r) == CMP_EQ, end);
+			}
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -957,6 +985,10 @@ static int simultaneous(void) {
 	eb_free(p);
 	eb_free(q);
 	eb_free(r);
+	for (int i = 0; i < 64; i++) {
+		bn_free(_k[i]);
+		eb_free(_p[i]);
+	}
 	return code;
 }
 
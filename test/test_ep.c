@@ -731,8 +731,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = STS_ERR;
-	bn_t n, k, l;
-	ep_t p, q, r;
+	bn_t n, k, l, _k[64];
+	ep_t p, q, r, _p[64];
 
 	bn_null(n);
 	bn_null(k);
@@ -740,6 +740,10 @@ static int simultaneous(void) {
 	ep_null(p);
 	ep_null(q);
 	ep_null(r);
+	for (int i = 0; i < 64; i++) {
+		bn_null(_k[i]);
+		ep_null(_p[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -748,6 +752,10 @@ static int simultaneous(void) {
 		ep_new(p);
 		ep_new(q);
 		ep_new(r);
+		for (int i = 0; i < 64; i++) {
+			bn_new(_k[i]);
+			ep_new(_p[i]);
+		}
 
 		ep_curve_get_gen(p);
 		ep_curve_get_ord(n);
@@ -825,6 +833,26 @@ static int simultaneous(void) {
 			ep_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			for (int j = 2; j <= 64; j += 62) {
+				ep_set_infty(q);
+				for (int i = 0; i < j; i++) {
+					bn_rand(_k[i], BN_POS, bn_bits(n));
+					bn_mod(_k[i], _k[i], n);
+					ep_rand(_p[i]);
+					ep_mul(r, _p[i], _k[i]);
+					if (i == 1) {
+						bn_neg(_k[i], _k[i]);
+						ep_neg(r, r);
+					}
+					ep_add(q, q, r);
+				}
+				ep_norm(q, q);
+				ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, j);
+				TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
+			}
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -838,6 +866,10 @@ static int simultaneous(void) {
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
+	for (int i = 0; i < 64; i++) {
+		bn_free(_k[i]);
+		ep_free(_p[i]);
+	}
 	return code;
 }
 
@@ -63,7 +63,7 @@ static int memory(void) {
 
 int util(void) {
 	int l, code = STS_ERR;
-	ep2_t a, b, c;
+	ep2_t a, b, c, t[3];
 	bn_t n;
 	uint8_t bin[4 * FP_BYTES + 1];
 
@@ -71,12 +71,18 @@ int util(void) {
 	ep2_null(b);
 	ep2_null(c);
 	bn_null(n);
+	for (int i = 0; i < 3; i++) {
+		ep2_null(t[i]);
+	}
 
 	TRY {
 		ep2_new(a);
 		ep2_new(b);
 		ep2_new(c);
 		bn_new(n);
+		for (int i = 0; i < 3; i++) {
+			ep2_new(t[i]);
+		}
 
 		TEST_BEGIN("comparison is consistent") {
 			ep2_rand(a);
@@ -131,6 +137,20 @@ int util(void) {
 		}
 		TEST_END;
 
+		TEST_BEGIN("simultaneous point normalization is correct") {
+			ep2_rand(t[0]);
+			ep2_dbl(t[0], t[0]);
+			ep2_rand(t[1]);
+			ep2_set_infty(t[2]);
+			ep2_norm(a, t[0]);
+			ep2_copy(b, t[1]);
+			ep2_norm_sim(t, t, 3);
+			TEST_ASSERT(ep2_cmp(t[0], a) == CMP_EQ && t[0]->norm, end);
+			TEST_ASSERT(ep2_cmp(t[1], b) == CMP_EQ, end);
+			TEST_ASSERT(ep2_is_infty(t[2]), end);
+		}
+		TEST_END;
+
 		TEST_BEGIN("reading and writing a point are consistent") {
 			for (int j = 0; j < 2; j++) {
 				ep2_set_infty(a);
@@ -164,6 +184,9 @@ int util(void) {
 	ep2_free(b);
 	ep2_free(c);
 	bn_free(n);
+	for (int i = 0; i < 3; i++) {
+		ep2_free(t[i]);
+	}
 	return code;
 }
 
@@ -504,7 +527,7 @@ static int multiplication(void) {
 		ep2_curve_get_ord(n);
 
 		TEST_BEGIN("generator has the right order") {
-			ep2_mul(r, p, n);
+			ep2_mul_basic(r, p, n);
 			TEST_ASSERT(ep2_is_infty(r) == 1, end);
 		} TEST_END;
 
@@ -516,6 +539,121 @@ static int multiplication(void) {
 			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
 		} TEST_END;
 
+#if EP_MUL == BASIC || !defined(STRIP)
+		TEST_BEGIN("binary point multiplication is correct") {
+			bn_rand(k, BN_POS, bn_bits(n));
+			bn_mod(k, k, n);
+			ep2_mul(q, p, k);
+			ep2_mul_basic(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			ep2_rand(p);
+			ep2_mul(q, p, k);
+			ep2_mul_basic(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
+#endif
+
+#if EP_MUL == SLIDE || !defined(STRIP)
+		TEST_BEGIN("sliding window point multiplication is correct") {
+			bn_rand(k, BN_POS, bn_bits(n));
+			bn_mod(k, k, n);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_slide(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			ep2_rand(p);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_slide(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
+#endif
+
+#if EP_MUL == MONTY || !defined(STRIP)
+		TEST_BEGIN("montgomery laddering point multiplication is correct") {
+			bn_rand(k, BN_POS, bn_bits(n));
+			bn_mod(k, k, n);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_monty(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			ep2_rand(p);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_monty(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
+#endif
+
+#if EP_MUL == LWNAF || !defined(STRIP)
+		TEST_BEGIN("left-to-right w-naf point multiplication is correct") {
+			bn_rand(k, BN_POS, bn_bits(n));
+			bn_mod(k, k, n);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			ep2_rand(p);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_lwnaf(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
+#endif
+
+#if (EP_MUL == LWNAF || !defined(STRIP)) && defined(EP_ENDOM) && FP_PRIME == 638
+		TEST_BEGIN("gls point multiplication on bls12 curves is correct") {
+			ep_param_set(B12_P638);
+			ep2_curve_set_twist(EP_MTYPE);
+			ep2_curve_get_ord(n);
+			ep2_rand(p);
+			for (int j = 0; j < 5; j++) {
+				switch (j) {
+					case 0:
+						bn_rand(k, BN_POS, bn_bits(n));
+						bn_mod(k, k, n);
+						break;
+					case 1:
+						bn_sub_dig(k, n, 1);
+						break;
+					case 2:
+						bn_rand(k, BN_POS, bn_bits(n) / 4);
+						break;
+					case 3:
+						bn_hlv(k, n);
+						break;
+					case 4:
+						/* Decomposes to (0, 1, 0, 0). */
+						fp_param_get_var(k);
+						bn_mod(k, k, n);
+						break;
+				}
+				ep2_mul_basic(q, p, k);
+				ep2_mul_lwnaf(r, p, k);
+				TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			}
+			ep_param_set_any_pairf();
+			ep2_curve_get_gen(p);
+			ep2_curve_get_ord(n);
+		} TEST_END;
+#endif
+
+#if EP_MUL == LWREG || !defined(STRIP)
+		TEST_BEGIN("left-to-right regular point multiplication is correct") {
+			bn_rand(k, BN_POS, bn_bits(n));
+			bn_mod(k, k, n);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_lwreg(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			ep2_rand(p);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_lwreg(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			bn_sub_dig(k, n, 1);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_lwreg(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			bn_set_dig(k, 2);
+			ep2_mul_basic(q, p, k);
+			ep2_mul_lwreg(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
+#endif
+
 		TEST_BEGIN("multiplication by digit is correct") {
 			bn_rand(k, BN_POS, BN_DIGIT);
 			ep2_mul(q, p, k);
@@ -703,8 +841,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = STS_ERR;
-	bn_t n, k, l;
-	ep2_t p, q, r, s;
+	bn_t n, k, l, _k[64];
+	ep2_t p, q, r, s, _p[64];
 
 	bn_null(n);
 	bn_null(k);
@@ -713,6 +851,10 @@ static int simultaneous(void) {
 	ep2_null(q);
 	ep2_null(r);
 	ep2_null(s);
+	for (int i = 0; i < 64; i++) {
+		bn_null(_k[i]);
+		ep2_null(_p[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -722,6 +864,10 @@ static int simultaneous(void) {
 		ep2_new(q);
 		ep2_new(r);
 		ep2_new(s);
+		for (int i = 0; i < 64; i++) {
+			bn_new(_k[i]);
+			ep2_new(_p[i]);
+		}
 
 		ep2_curve_get_gen(p);
 		ep2_curve_get_ord(n);
@@ -797,6 +943,26 @@ static int simultaneous(void) {
 			ep2_mul_sim(q, s, k, q, l);
 			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			for (int j = 2; j <= 64; j += 62) {
+				ep2_set_infty(q);
+				for (int i = 0; i < j; i++) {
+					bn_rand(_k[i], BN_POS, bn_bits(n));
+					bn_mod(_k[i], _k[i], n);
+					ep2_rand(_p[i]);
+					ep2_mul(r, _p[i], _k[i]);
+					if (i == 1) {
+						bn_neg(_k[i], _k[i]);
+						ep2_neg(r, r);
+					}
+					ep2_add(q, q, r);
+				}
+				ep2_norm(q, q);
+				ep2_mul_sim_lot(r, _p, _k, j);
+				TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			}
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -811,6 +977,10 @@ static int simultaneous(void) {
 	ep2_free(q);
 	ep2_free(r);
 	ep2_free(s);
+	for (int i = 0; i < 64; i++) {
+		bn_free(_k[i]);
+		ep2_free(_p[i]);
+	}
 	return code;
 }
 
@@ -864,7 +1034,7 @@ static int hashing(void) {
 		TEST_BEGIN("point hashing is correct") {
 			rand_bytes(msg, sizeof(msg));
 			ep2_map(p, msg, sizeof(msg));
-			ep2_mul(p, p, n);
+			ep2_mul_basic(p, p, n);
 			TEST_ASSERT(ep2_is_infty(p) == 1, end);
 		}
 		TEST_END;
@@ -476,6 +476,25 @@ static int multiplication(void) {
 		}
 		TEST_END;
 #endif
+
+#if defined(CPUID) && ARCH == X64
+		TEST_BEGIN("multiplication kernels selected at run time are correct") {
+			int ext = arch_get_ext();
+			fb_rand(a);
+			fb_rand(b);
+			arch_set_ext(0);
+			fb_mul(c, a, b);
+			arch_set_ext(ext);
+			fb_mul(d, a, b);
+			TEST_ASSERT(fb_cmp(c, d) == CMP_EQ, end);
+			arch_set_ext(0);
+			fb_mul_dig(c, a, b[0]);
+			arch_set_ext(ext);
+			fb_mul_dig(d, a, b[0]);
+			TEST_ASSERT(fb_cmp(c, d) == CMP_EQ, end);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
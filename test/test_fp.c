@@ -388,8 +388,9 @@ static int subtraction(void) {
 }
 
 static int multiplication(void) {
-	int code = STS_ERR;
-	fp_t a, b, c, d, e, f;
+	int j, code = STS_ERR;
+	fp_t a, b, c, d, e, f, g[FP_LANES + 1], h[FP_LANES + 1];
+	dv_t t, u;
 
 	fp_null(a);
 	fp_null(b);
@@ -397,6 +398,12 @@ static int multiplication(void) {
 	fp_null(d);
 	fp_null(e);
 	fp_null(f);
+	dv_null(t);
+	dv_null(u);
+	for (j = 0; j <= FP_LANES; j++) {
+		fp_null(g[j]);
+		fp_null(h[j]);
+	}
 
 	TRY {
 		fp_new(a);
@@ -405,6 +412,12 @@ static int multiplication(void) {
 		fp_new(d);
 		fp_new(e);
 		fp_new(f);
+		dv_new(t);
+		dv_new(u);
+		for (j = 0; j <= FP_LANES; j++) {
+			fp_new(g[j]);
+			fp_new(h[j]);
+		}
 
 		TEST_BEGIN("multiplication is commutative") {
 			fp_rand(a);
@@ -494,6 +507,78 @@ static int multiplication(void) {
 		}
 		TEST_END;
 #endif
+
+		TEST_BEGIN("multiplication with lazy reduction is correct") {
+			fp_rand(a);
+			fp_rand(b);
+			fp_rand(c);
+			fp_rand(d);
+			fp_mul(e, a, b);
+			fp_mul(f, c, d);
+			fp_sub(e, e, f);
+			fp_sqr(f, a);
+			fp_add(e, e, f);
+			fp_mul_unr(t, a, b);
+			fp_mls_unr(t, c, d);
+			fp_mla_unr(t, a, a);
+			fp_rdc(f, t);
+			TEST_ASSERT(fp_cmp(e, f) == CMP_EQ, end);
+			fp_sqr(e, a);
+			fp_sqr(f, b);
+			fp_sub(e, e, f);
+			fp_sqr_unr(t, a);
+			fp_sqr_unr(u, b);
+			fp_subc(t, t, u);
+			fp_rdc(f, t);
+			TEST_ASSERT(fp_cmp(e, f) == CMP_EQ, end);
+			fp_sqr(f, b);
+			fp_add(e, e, f);
+			fp_add(e, e, f);
+			fp_sqr_unr(t, a);
+			fp_addc(t, t, u);
+			fp_rdc(f, t);
+			TEST_ASSERT(fp_cmp(e, f) == CMP_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication is correct") {
+			for (j = 0; j <= FP_LANES; j++) {
+				fp_rand(g[j]);
+				fp_rand(h[j]);
+			}
+			fp_copy(a, g[0]);
+			fp_copy(b, g[FP_LANES]);
+			fp_mul_sim(g, (const fp_t *)g, (const fp_t *)h, FP_LANES + 1);
+			fp_mul(c, a, h[0]);
+			fp_mul(d, b, h[FP_LANES]);
+			TEST_ASSERT(fp_cmp(g[0], c) == CMP_EQ &&
+					fp_cmp(g[FP_LANES], d) == CMP_EQ, end);
+			for (j = 0; j < FP_LANES; j++) {
+				fp_copy(g[j], h[j]);
+			}
+			fp_mul_sim(h, (const fp_t *)h, (const fp_t *)g, FP_LANES);
+			for (j = 0; j < FP_LANES; j++) {
+				fp_sqr(c, g[j]);
+				TEST_ASSERT(fp_cmp(h[j], c) == CMP_EQ, end);
+			}
+		} TEST_END;
+
+#if defined(CPUID) && ARCH == X64
+		TEST_BEGIN("multiplication kernels selected at run time are correct") {
+			int ext = arch_get_ext();
+			fp_rand(a);
+			fp_rand(b);
+			arch_set_ext(0);
+			fp_mul(c, a, b);
+			arch_set_ext(ext);
+			fp_mul(d, a, b);
+			TEST_ASSERT(fp_cmp(c, d) == CMP_EQ, end);
+#if FP_MUL == INTEG || !defined(STRIP)
+			fp_mul_integ(d, a, b);
+			TEST_ASSERT(fp_cmp(c, d) == CMP_EQ, end);
+#endif
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -506,6 +591,12 @@ static int multiplication(void) {
 	fp_free(d);
 	fp_free(e);
 	fp_free(f);
+	dv_free(t);
+	dv_free(u);
+	for (j = 0; j <= FP_LANES; j++) {
+		fp_free(g[j]);
+		fp_free(h[j]);
+	}
 	return code;
 }
 
@@ -564,6 +655,22 @@ static int squaring(void) {
 			TEST_ASSERT(fp_cmp(b, c) == CMP_EQ, end);
 		} TEST_END;
 #endif
+
+#if defined(CPUID) && ARCH == X64
+		TEST_BEGIN("squaring kernels selected at run time are correct") {
+			int ext = arch_get_ext();
+			fp_rand(a);
+			arch_set_ext(0);
+			fp_sqr(b, a);
+			arch_set_ext(ext);
+			fp_sqr(c, a);
+			TEST_ASSERT(fp_cmp(b, c) == CMP_EQ, end);
+#if FP_SQR == INTEG || !defined(STRIP)
+			fp_sqr_integ(c, a);
+			TEST_ASSERT(fp_cmp(b, c) == CMP_EQ, end);
+#endif
+		} TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -791,14 +898,18 @@ static int reduction(void) {
 }
 
 static int inversion(void) {
-	int code = STS_ERR;
-	fp_t a, b, c, d[2];
+	int j, code = STS_ERR;
+	fp_t a, b, c, d[2], e[2 * FP_LANES + 3], f[2 * FP_LANES + 3];
 
 	fp_null(a);
 	fp_null(b);
 	fp_null(c);
 	fp_null(d[0]);
 	fp_null(d[1]);
+	for (j = 0; j < 2 * FP_LANES + 3; j++) {
+		fp_null(e[j]);
+		fp_null(f[j]);
+	}
 
 	TRY {
 		fp_new(a);
@@ -806,6 +917,10 @@ static int inversion(void) {
 		fp_new(c);
 		fp_new(d[0]);
 		fp_new(d[1]);
+		for (j = 0; j < 2 * FP_LANES + 3; j++) {
+			fp_new(e[j]);
+			fp_new(f[j]);
+		}
 
 		TEST_BEGIN("inversion is correct") {
 			fp_rand(a);
@@ -871,6 +986,19 @@ static int inversion(void) {
 			TEST_ASSERT(fp_cmp(d[0], a) == CMP_EQ &&
 					fp_cmp(d[1], b) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous inversion of many elements is correct") {
+			for (j = 0; j < 2 * FP_LANES + 3; j++) {
+				fp_rand(e[j]);
+				fp_copy(f[j], e[j]);
+			}
+			fp_inv_sim(e, (const fp_t *)e, 2 * FP_LANES + 3);
+			fp_set_dig(b, 1);
+			for (j = 0; j < 2 * FP_LANES + 3; j++) {
+				fp_mul(c, e[j], f[j]);
+				TEST_ASSERT(fp_cmp(c, b) == CMP_EQ, end);
+			}
+		} TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -882,6 +1010,10 @@ static int inversion(void) {
 	fp_free(c);
 	fp_free(d[0]);
 	fp_free(d[1]);
+	for (j = 0; j < 2 * FP_LANES + 3; j++) {
+		fp_free(e[j]);
+		fp_free(f[j]);
+	}
 	return code;
 }
 
@@ -942,6 +1074,31 @@ static int exponentiation(void) {
 		}
 		TEST_END;
 #endif
+
+		TEST_BEGIN("exponentiation by addition chains is correct") {
+			fp_chain_t ch;
+			fp_rand(a);
+			bn_rand(d, BN_POS, FP_BITS);
+			fp_exp(c, a, d);
+			fp_exp_gen(&ch, d);
+			fp_exp_chain(b, a, &ch);
+			TEST_ASSERT(fp_cmp(b, c) == CMP_EQ, end);
+			bn_zero(d);
+			fp_exp_gen(&ch, d);
+			fp_exp_chain(b, a, &ch);
+			TEST_ASSERT(fp_cmp_dig(b, 1) == CMP_EQ, end);
+			bn_rand(d, BN_POS, FP_BITS);
+			fp_exp(c, a, d);
+			fp_inv(c, c);
+			bn_neg(d, d);
+			fp_exp_gen(&ch, d);
+			fp_exp_chain(b, a, &ch);
+			TEST_ASSERT(fp_cmp(b, c) == CMP_EQ, end);
+			fp_inv(c, a);
+			fp_exp_chain(b, a, fp_prime_get_chain(FP_CHAIN_INV));
+			TEST_ASSERT(fp_cmp(b, c) == CMP_EQ, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
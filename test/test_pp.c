@@ -622,9 +622,10 @@ static int doubling12(void) {
 static int pairing12(void) {
 	int code = STS_ERR;
 	bn_t k, n;
-	ep_t p;
-	ep2_t q, r;
+	ep_t p, _p[2];
+	ep2_t q, r, _q[2];
 	fp12_t e1, e2;
+	fp6_t t[PP_TABLE];
 
 	bn_null(k);
 	bn_null(n);
@@ -633,6 +634,13 @@ static int pairing12(void) {
 	ep2_null(r);
 	fp12_null(e1);
 	fp12_null(e2);
+	for (int j = 0; j < 2; j++) {
+		ep_null(_p[j]);
+		ep2_null(_q[j]);
+	}
+	for (int j = 0; j < PP_TABLE; j++) {
+		fp6_null(t[j]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -642,6 +650,13 @@ static int pairing12(void) {
 		ep2_new(r);
 		fp12_new(e1);
 		fp12_new(e2);
+		for (int j = 0; j < 2; j++) {
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
+		}
+		for (int j = 0; j < PP_TABLE; j++) {
+			fp6_new(t[j]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -668,6 +683,24 @@ static int pairing12(void) {
 			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
 
+		TEST_BEGIN("multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep2_rand(_q[0]);
+			ep2_rand(_q[1]);
+			pp_map_k12(e1, _p[0], _q[0]);
+			pp_map_k12(e2, _p[1], _q[1]);
+			fp12_mul(e1, e1, e2);
+			pp_map_sim_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep2_copy(_q[1], _q[0]);
+			pp_map_sim_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1), end);
+			pp_map_sim_k12(e2, _p, _q, 0);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1), end);
+		} TEST_END;
+
 #if PP_MAP == TATEP || !defined(STRIP)
 		TEST_BEGIN("tate pairing is not degenerate") {
 			ep_rand(p);
@@ -741,6 +774,37 @@ static int pairing12(void) {
 			pp_map_oatep_k12(e2, p, q);
 			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("optimal ate multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep2_rand(_q[0]);
+			ep2_rand(_q[1]);
+			pp_map_oatep_k12(e1, _p[0], _q[0]);
+			pp_map_oatep_k12(e2, _p[1], _q[1]);
+			fp12_mul(e1, e1, e2);
+			pp_map_sim_oatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			pp_map_oatep_k12(e1, _p[0], _q[0]);
+			ep2_set_infty(_q[1]);
+			pp_map_sim_oatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("optimal ate pairing with fixed argument is correct") {
+			ep_rand(p);
+			ep2_rand(q);
+			pp_map_pre_k12(t, q);
+			pp_map_oatep_k12(e1, p, q);
+			pp_map_fix_k12(e2, p, t);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			bn_rand(k, BN_POS, bn_bits(n));
+			bn_mod(k, k, n);
+			ep_mul(p, p, k);
+			pp_map_oatep_k12(e1, p, q);
+			pp_map_fix_k12(e2, p, t);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+		} TEST_END;
 #endif
 	}
 	CATCH_ANY {
@@ -756,6 +820,13 @@ static int pairing12(void) {
 	ep2_free(r);
 	fp12_free(e1);
 	fp12_free(e2);
+	for (int j = 0; j < 2; j++) {
+		ep_free(_p[j]);
+		ep2_free(_q[j]);
+	}
+	for (int j = 0; j < PP_TABLE; j++) {
+		fp6_free(t[j]);
+	}
 	return code;
 }
 